@@ -0,0 +1,67 @@
+#include <linux/kernel.h>
+#include <linux/minmax.h>
+#include <linux/moduleparam.h>
+#include <linux/printk.h>
+
+#include "analysis.h"
+
+static unsigned int multi_pv = 1;
+module_param(multi_pv, uint, 0644);
+MODULE_PARM_DESC(multi_pv, "Number of root moves analysed by each engine");
+
+/* Lines to produce, the main one included */
+int analysis_n_lines(void)
+{
+    return clamp_t(int, READ_ONCE(multi_pv), 1, MAX_MULTI_PV);
+}
+
+/* A move played without a search, from the opening book or a forced win */
+void analysis_single(struct analysis *a, char player, int move, int score)
+{
+    a->player = player;
+    a->depth = 0;
+    a->n_lines = move >= 0;
+    a->lines[0].score = score;
+    a->lines[0].length = 1;
+    a->lines[0].moves[0] = move;
+}
+
+static int format_line(const char *engine,
+                       const struct analysis *a,
+                       int i,
+                       char *buf,
+                       size_t size)
+{
+    const struct pv_line *line = &a->lines[i];
+    int len = scnprintf(buf, size, "%s %c depth %d pv %d score %d:", engine,
+                        a->player, a->depth, i + 1, line->score);
+
+    for (int k = 0; k < line->length; k++)
+        len += scnprintf(buf + len, size - len, " %d", line->moves[k]);
+    return len;
+}
+
+/* One line per variation, as for the sysfs attribute analysis */
+int analysis_format(const char *engine,
+                    const struct analysis *a,
+                    char *buf,
+                    size_t size)
+{
+    int len = 0;
+
+    for (int i = 0; i < a->n_lines; i++) {
+        len += format_line(engine, a, i, buf + len, size - len);
+        len += scnprintf(buf + len, size - len, "\n");
+    }
+    return len;
+}
+
+void analysis_log(const char *engine, const struct analysis *a)
+{
+    char buf[64 + MAX_PV_LENGTH * 4];
+
+    for (int i = 0; i < a->n_lines; i++) {
+        format_line(engine, a, i, buf, sizeof(buf));
+        pr_info("kmldrv: [PV] %s\n", buf);
+    }
+}
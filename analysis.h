@@ -0,0 +1,32 @@
+#pragma once
+
+#include <linux/types.h>
+
+/* What an engine found on its last move: its principal variation, the line
+ * it expects both players to follow, and with multi_pv the lines of the next
+ * best root moves. Negamax scores a line in evaluation units, MCTS in per
+ * mille of the root visits that went to its first move.
+ */
+#define MAX_PV_LENGTH 16
+#define MAX_MULTI_PV 4
+
+struct pv_line {
+    int score;
+    int length;
+    unsigned char moves[MAX_PV_LENGTH];
+};
+
+struct analysis {
+    char player;
+    int depth; /* iterations completed by negamax, run by MCTS */
+    int n_lines;
+    struct pv_line lines[MAX_MULTI_PV];
+};
+
+int analysis_n_lines(void);
+void analysis_single(struct analysis *a, char player, int move, int score);
+int analysis_format(const char *engine,
+                    const struct analysis *a,
+                    char *buf,
+                    size_t size);
+void analysis_log(const char *engine, const struct analysis *a);
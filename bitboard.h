@@ -0,0 +1,89 @@
+#pragma once
+
+#ifdef __KERNEL__
+#include <linux/bitops.h>
+#endif
+
+/* 256-bit bitboards, one bit per grid in row-major order, which covers a
+ * 15x15 board. Every operation takes the number of 64-bit words in use, a
+ * constant within the specialized primitives of game.c, so that a board of
+ * up to 8x8 only ever touches the first word.
+ */
+#define BITBOARD_BITS 256
+#define BITBOARD_WORDS(n_bits) (((n_bits) + 63) >> 6)
+
+typedef struct {
+    unsigned long long w[BITBOARD_WORDS(BITBOARD_BITS)];
+} bitboard_t;
+
+static inline void bb_clear(bitboard_t *b, int nw)
+{
+    for (int i = 0; i < nw; i++)
+        b->w[i] = 0;
+}
+
+static inline void bb_set(bitboard_t *b, int bit)
+{
+    b->w[bit >> 6] |= 1ULL << (bit & 63);
+}
+
+static inline void bb_reset(bitboard_t *b, int bit)
+{
+    b->w[bit >> 6] &= ~(1ULL << (bit & 63));
+}
+
+/* Bits of the w-th word that stand for one of the first n_bits grids */
+static inline unsigned long long bb_word_mask(int w, int n_bits)
+{
+    int n = n_bits - (w << 6);
+    return n >= 64 ? ~0ULL : ~0ULL >> (64 - n);
+}
+
+/* Whether every bit of mask is set in b */
+static inline int bb_contains(const bitboard_t *b,
+                              const bitboard_t *mask,
+                              int nw)
+{
+    unsigned long long missing = 0;
+    for (int i = 0; i < nw; i++)
+        missing |= mask->w[i] & ~b->w[i];
+    return !missing;
+}
+
+/* Whether a and b have a bit in common */
+static inline int bb_intersects(const bitboard_t *a,
+                                const bitboard_t *b,
+                                int nw)
+{
+    unsigned long long common = 0;
+    for (int i = 0; i < nw; i++)
+        common |= a->w[i] & b->w[i];
+    return !!common;
+}
+
+/* Whether the first n_bits bits of b are all set */
+static inline int bb_full(const bitboard_t *b, int n_bits, int nw)
+{
+    unsigned long long missing = 0;
+    for (int i = 0; i < nw; i++)
+        missing |= bb_word_mask(i, n_bits) & ~b->w[i];
+    return !missing;
+}
+
+/* The kernel has no libgcc to back __builtin_popcountll() */
+static inline int bb_popcount(unsigned long long x)
+{
+#ifdef __KERNEL__
+    return hweight64(x);
+#else
+    return __builtin_popcountll(x);
+#endif
+}
+
+/* Index of the k-th lowest set bit of x, which has more than k bits set */
+static inline int bb_select(unsigned long long x, int k)
+{
+    while (k--)
+        x &= x - 1;
+    return __builtin_ctzll(x);
+}
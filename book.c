@@ -0,0 +1,48 @@
+#include <linux/bsearch.h>
+#include <linux/moduleparam.h>
+
+#include "book.h"
+#include "opening_book.h"
+
+static bool use_book = true;
+module_param(use_book, bool, 0644);
+MODULE_PARM_DESC(use_book, "Play opening book moves without searching");
+
+static int cmp_key(const void *key, const void *elt)
+{
+    unsigned int a = *(const unsigned int *) key;
+    unsigned int b = *(const unsigned int *) elt;
+    return a < b ? -1 : a > b;
+}
+
+/* Returns the book move for player, or -1 outside of the book */
+int book_probe(const char *table, char player)
+{
+    int n_o = 0, n_x = 0, sym;
+
+    /* The book is built for the default variant */
+    if (!use_book || BOOK_BOARD_SIZE != BOARD_SIZE || BOOK_GOAL != GOAL ||
+        BOOK_ALLOW_EXCEED != ALLOW_EXCEED || game->board_size != BOARD_SIZE ||
+        game->goal != GOAL)
+        return -1;
+
+    for (int i = 0; i < N_GRIDS; i++) {
+        n_o += table[i] == 'O';
+        n_x += table[i] == 'X';
+    }
+    /* The book is built with 'O' moving first */
+    if (n_o + n_x >= BOOK_DEPTH || n_o - n_x != (player == 'X'))
+        return -1;
+
+    unsigned int key = book_canonical_key(table, &sym);
+    const unsigned int *entry =
+        bsearch(&key, opening_book_keys, BOOK_SIZE, sizeof(*entry), cmp_key);
+    if (!entry)
+        return -1;
+
+    int move = opening_book_moves[entry - opening_book_keys];
+    for (int i = 0; i < N_GRIDS; i++)
+        if (symmetry_grid(sym, i) == move)
+            return i;
+    return -1;
+}
@@ -0,0 +1,66 @@
+#pragma once
+
+#include "game.h"
+
+/* Opening book: for every position with fewer than BOOK_DEPTH stones, up to
+ * the symmetries of the square board, the best move found by an exhaustive
+ * search. The tables are generated by kmldrv-book into opening_book.h, as
+ * the sorted keys and the moves in the same order.
+ *
+ * Positions are keyed by the base-3 number whose digit at the place of each
+ * grid is 0 for an empty grid, 1 for 'O' and 2 for 'X', which is a perfect
+ * hash as long as 3^N_GRIDS fits in 32 bits. The canonical key is the
+ * smallest key over the eight symmetries, and the book move is stored in the
+ * orientation of the canonical key.
+ */
+#define N_SYMMETRIES 8
+
+/* Grid under the s-th symmetry: bit 0 flips the rows, bit 1 flips the
+ * columns, then bit 2 transposes the board.
+ */
+static inline int symmetry_grid(int s, int grid)
+{
+    int i = GET_ROW(grid), j = GET_COL(grid);
+    if (s & 1)
+        i = BOARD_SIZE - 1 - i;
+    if (s & 2)
+        j = BOARD_SIZE - 1 - j;
+    if (s & 4) {
+        int t = i;
+        i = j;
+        j = t;
+    }
+    return GET_INDEX(i, j);
+}
+
+static inline unsigned int book_key(const char *table, int s)
+{
+    unsigned int pow3[N_GRIDS];
+    unsigned int key = 0;
+
+    pow3[0] = 1;
+    for (int i = 1; i < N_GRIDS; i++)
+        pow3[i] = pow3[i - 1] * 3;
+    for (int i = 0; i < N_GRIDS; i++) {
+        if (table[i] != ' ')
+            key += pow3[symmetry_grid(s, i)] * (table[i] == 'O' ? 1 : 2);
+    }
+    return key;
+}
+
+/* Returns the canonical key and stores the symmetry producing it in *sym */
+static inline unsigned int book_canonical_key(const char *table, int *sym)
+{
+    unsigned int best = book_key(table, 0);
+    *sym = 0;
+    for (int s = 1; s < N_SYMMETRIES; s++) {
+        unsigned int key = book_key(table, s);
+        if (key < best) {
+            best = key;
+            *sym = s;
+        }
+    }
+    return best;
+}
+
+int book_probe(const char *table, char player);
@@ -1,50 +1,492 @@
-#include <linux/slab.h>
+#ifdef __KERNEL__
+#include <linux/build_bug.h>
+#include <linux/kernel.h>
+#include <linux/minmax.h>
+#include <linux/string.h>
+#else
+/* Built into kmldrv-rules, which checks the primitives in userspace */
+#include <string.h>
+#ifndef __always_inline
+#define __always_inline inline __attribute__((__always_inline__))
+#endif
+#define ARRAY_SIZE(a) (sizeof(a) / sizeof((a)[0]))
+#define min(a, b) ((a) < (b) ? (a) : (b))
+#define max(a, b) ((a) > (b) ? (a) : (b))
+#define static_assert(expr, ...) _Static_assert(expr, #expr)
+#endif
 
 #include "game.h"
+#include "util.h"
 
+static_assert(MAX_GRIDS <= BITBOARD_BITS);
 
-const line_t lines[4] = {
-    {1, 0, 0, 0, BOARD_SIZE - GOAL + 1, BOARD_SIZE},             // ROW
-    {0, 1, 0, 0, BOARD_SIZE, BOARD_SIZE - GOAL + 1},             // COL
-    {1, 1, 0, 0, BOARD_SIZE - GOAL + 1, BOARD_SIZE - GOAL + 1},  // PRIMARY
-    {1, -1, 0, GOAL - 1, BOARD_SIZE - GOAL + 1, BOARD_SIZE},     // SECONDARY
-};
-
-static char check_line_segment_win(const char *t, int i, int j, line_t line)
+/* The primitives below are written once for any variant and instantiated by
+ * DEFINE_GAME_VARIANT() with the size, the goal and the candidate radius as
+ * constants, so that every loop has a fixed trip count and the tables are
+ * indexed directly.
+ */
+static __always_inline char __check_win(const struct game_variant *v,
+                                        const char *t,
+                                        const int size,
+                                        const int goal)
 {
-    char last = t[GET_INDEX(i, j)];
-    if (last == ' ')
+    const int nw = BITBOARD_WORDS(size * size);
+    bitboard_t o, x, occupied;
+
+    bb_clear(&o, nw);
+    bb_clear(&x, nw);
+    for (int i = 0; i < size * size; i++) {
+        o.w[i >> 6] |= (unsigned long long) (t[i] == 'O') << (i & 63);
+        x.w[i >> 6] |= (unsigned long long) (t[i] == 'X') << (i & 63);
+    }
+    for (int i = 0; i < N_SEGMENTS_OF(size, goal); i++) {
+        if (bb_contains(&o, &v->win_masks[i], nw) &&
+            (ALLOW_EXCEED || !bb_intersects(&o, &v->flank_masks[i], nw)))
+            return 'O';
+        if (bb_contains(&x, &v->win_masks[i], nw) &&
+            (ALLOW_EXCEED || !bb_intersects(&x, &v->flank_masks[i], nw)))
+            return 'X';
+    }
+    for (int i = 0; i < nw; i++)
+        occupied.w[i] = o.w[i] | x.w[i];
+    if (!bb_full(&occupied, size * size, nw))
         return ' ';
-    for (int k = 1; k < GOAL; k++) {
-        if (last != t[GET_INDEX(i + k * line.i_shift, j + k * line.j_shift)])
-            return ' ';
+    return 'D';
+}
+
+/* Whether a flanking grid of segment holds a stone of player */
+static __always_inline bool __flanked(const char *t,
+                                      const segment_t *segment,
+                                      char player)
+{
+    return (segment->flanks[0] >= 0 && t[segment->flanks[0]] == player) ||
+           (segment->flanks[1] >= 0 && t[segment->flanks[1]] == player);
+}
+
+/* Only the segments through the last move can have been completed by it */
+static __always_inline char __check_move_win(const struct game_variant *v,
+                                             const char *t,
+                                             int move,
+                                             const int goal)
+{
+    char player = t[move];
+    for (int i = 0; i < v->n_grid_segments[move]; i++) {
+        const segment_t *segment =
+            &v->segments[v->grid_segments[move][i].segment];
+        int k = 0;
+        while (k < goal && t[segment->grids[k]] == player)
+            k++;
+        if (k == goal && (ALLOW_EXCEED || !__flanked(t, segment, player)))
+            return player;
     }
+    return ' ';
+}
 
-#if !ALLOW_EXCEED
-    if (last == LOOKUP(t, i - line.i_shift, j - line.j_shift, ' ') ||
-        last ==
-            LOOKUP(t, i + GOAL * line.i_shift, j + GOAL * line.j_shift, ' '))
-        return ' ';
-#endif
-    return last;
+static __always_inline void __segment_masks(const char *table,
+                                            const segment_t *segment,
+                                            char player,
+                                            const int goal,
+                                            int *own,
+                                            int *opponent)
+{
+    *own = *opponent = 0;
+    for (int k = 0; k < goal; k++) {
+        char curr = table[segment->grids[k]];
+        *own |= (curr == player) << k;
+        *opponent |= (curr != player && curr != ' ') << k;
+    }
+}
+
+/* Without ALLOW_EXCEED, a segment flanked by a stone of a player can only
+ * become an overline for that player. Its stones still block the other
+ * player, so the segment is worth nothing once it holds any of them.
+ */
+static __always_inline int __segment_value(const struct game_variant *v,
+                                           int own,
+                                           int opponent,
+                                           bool own_flanked,
+                                           bool opponent_flanked)
+{
+    if (!ALLOW_EXCEED &&
+        ((own && own_flanked) || (opponent && opponent_flanked)))
+        return 0;
+    return v->pattern_score[own][opponent];
+}
+
+static __always_inline int __segment_score(const struct game_variant *v,
+                                           const char *table,
+                                           const segment_t *segment,
+                                           char player,
+                                           const int goal)
+{
+    int own, opponent;
+    bool own_flanked = false, opponent_flanked = false;
+
+    __segment_masks(table, segment, player, goal, &own, &opponent);
+    if (!ALLOW_EXCEED) {
+        own_flanked = __flanked(table, segment, player);
+        opponent_flanked = __flanked(table, segment, player ^ 'O' ^ 'X');
+    }
+    return __segment_value(v, own, opponent, own_flanked, opponent_flanked);
+}
+
+static __always_inline int __get_score(const struct game_variant *v,
+                                       const char *table,
+                                       char player,
+                                       const int size,
+                                       const int goal)
+{
+    int score = 0;
+    for (int i = 0; i < N_SEGMENTS_OF(size, goal); i++)
+        score += __segment_score(v, table, &v->segments[i], player, goal);
+    return score;
+}
+
+static __always_inline int __eval_move_delta(const struct game_variant *v,
+                                             const char *table,
+                                             int move,
+                                             char player,
+                                             const int goal)
+{
+    char opponent_stone = player ^ 'O' ^ 'X';
+    int delta = 0;
+    for (int i = 0; i < v->n_grid_segments[move]; i++) {
+        const grid_segment_t *gs = &v->grid_segments[move][i];
+        const segment_t *segment = &v->segments[gs->segment];
+        int own, opponent;
+        bool own_flanked = false, opponent_flanked = false;
+
+        __segment_masks(table, segment, player, goal, &own, &opponent);
+        if (!ALLOW_EXCEED) {
+            own_flanked = __flanked(table, segment, player);
+            opponent_flanked = __flanked(table, segment, opponent_stone);
+        }
+        delta -= __segment_value(v, own, opponent, own_flanked,
+                                 opponent_flanked);
+        delta += __segment_value(v, own | (1 << gs->offset), opponent,
+                                 own_flanked, opponent_flanked);
+    }
+    /* The move also flanks the segments right before and after it */
+    for (int i = 0; !ALLOW_EXCEED && i < v->n_grid_flanks[move]; i++) {
+        const segment_t *segment = &v->segments[v->grid_flanks[move][i]];
+        int own, opponent;
+        bool opponent_flanked;
+
+        __segment_masks(table, segment, player, goal, &own, &opponent);
+        opponent_flanked = __flanked(table, segment, opponent_stone);
+        delta -= __segment_value(v, own, opponent,
+                                 __flanked(table, segment, player),
+                                 opponent_flanked);
+        delta += __segment_value(v, own, opponent, true, opponent_flanked);
+    }
+    return delta;
+}
+
+/* Calls fn(mg, grid) for every grid within radius rows and columns of move */
+#define for_each_near_grid(mg, move, size, radius, fn)                        \
+    do {                                                                     \
+        int row = (move) / (size), col = (move) % (size);                    \
+        int i_end = min(row + (radius), (size) - 1);                         \
+        int j_end = min(col + (radius), (size) - 1);                         \
+        for (int i = max(row - (radius), 0); i <= i_end; i++)                \
+            for (int j = max(col - (radius), 0); j <= j_end; j++)            \
+                fn(mg, i * (size) + j);                                      \
+    } while (0)
+
+static __always_inline void __near_inc(struct movegen *mg, int grid)
+{
+    if (!mg->n_near[grid]++)
+        bb_set(&mg->near, grid);
+}
+
+static __always_inline void __near_dec(struct movegen *mg, int grid)
+{
+    if (!--mg->n_near[grid])
+        bb_reset(&mg->near, grid);
+}
+
+static __always_inline void __block(struct movegen *mg, int p, int segment)
+{
+    if (!mg->blocked[p][segment]++)
+        mg->n_open[p]--;
+}
+
+static __always_inline void __unblock(struct movegen *mg, int p, int segment)
+{
+    if (!--mg->blocked[p][segment])
+        mg->n_open[p]++;
+}
+
+/* A stone of p shuts the segments through it for the opponent and, without
+ * ALLOW_EXCEED, the segments it flanks for p. Sparse variants skip this, a
+ * line is completed long before they run out of open segments.
+ */
+#define for_each_blocked_segment(v, mg, move, p, fn)                         \
+    do {                                                                     \
+        for (int i = 0; i < (v)->n_grid_segments[move]; i++)                 \
+            fn(mg, !(p), (v)->grid_segments[move][i].segment);               \
+        for (int i = 0; !ALLOW_EXCEED && i < (v)->n_grid_flanks[move]; i++)  \
+            fn(mg, p, (v)->grid_flanks[move][i]);                            \
+    } while (0)
+
+static __always_inline void __movegen_play(const struct game_variant *v,
+                                           struct movegen *mg,
+                                           int move,
+                                           char player,
+                                           const int size,
+                                           const int radius)
+{
+    bb_set(&mg->occupied, move);
+    mg->n_stones++;
+    if (radius)
+        for_each_near_grid(mg, move, size, radius, __near_inc);
+    else
+        for_each_blocked_segment(v, mg, move, player == 'X', __block);
+}
+
+static __always_inline void __movegen_undo(const struct game_variant *v,
+                                           struct movegen *mg,
+                                           int move,
+                                           char player,
+                                           const int size,
+                                           const int radius)
+{
+    bb_reset(&mg->occupied, move);
+    mg->n_stones--;
+    if (radius)
+        for_each_near_grid(mg, move, size, radius, __near_dec);
+    else
+        for_each_blocked_segment(v, mg, move, player == 'X', __unblock);
+}
+
+static __always_inline void __movegen_init(const struct game_variant *v,
+                                           struct movegen *mg,
+                                           const char *table,
+                                           const int size,
+                                           const int goal,
+                                           const int radius)
+{
+    const int nw = BITBOARD_WORDS(size * size);
+
+    bb_clear(&mg->occupied, nw);
+    bb_clear(&mg->near, nw);
+    mg->n_stones = 0;
+    if (radius)
+        memset(mg->n_near, 0, size * size);
+    mg->n_open[0] = mg->n_open[1] = N_SEGMENTS_OF(size, goal);
+    memset(mg->blocked[0], 0, N_SEGMENTS_OF(size, goal));
+    memset(mg->blocked[1], 0, N_SEGMENTS_OF(size, goal));
+    for (int i = 0; i < size * size; i++)
+        if (table[i] != ' ')
+            __movegen_play(v, mg, i, table[i], size, radius);
+}
+
+/* The w-th word of the candidate moves */
+static __always_inline unsigned long long __movegen_word(
+    const struct movegen *mg,
+    int w,
+    const int size,
+    const int radius)
+{
+    const int center = (size >> 1) * size + (size >> 1);
+
+    if (radius && !mg->n_stones)
+        return w == center >> 6 ? 1ULL << (center & 63) : 0;
+    unsigned long long x = ~mg->occupied.w[w] & bb_word_mask(w, size * size);
+    if (radius)
+        x &= mg->near.w[w];
+    return x;
+}
+
+static __always_inline int __movegen_moves(const struct movegen *mg,
+                                           int *moves,
+                                           const int size,
+                                           const int radius)
+{
+    int n_moves = 0;
+    for (int w = 0; w < BITBOARD_WORDS(size * size); w++) {
+        unsigned long long x = __movegen_word(mg, w, size, radius);
+        for (; x; x &= x - 1)
+            moves[n_moves++] = (w << 6) + __builtin_ctzll(x);
+    }
+    return n_moves;
+}
+
+static __always_inline int __movegen_pick(const struct movegen *mg,
+                                          unsigned long long r,
+                                          const int size,
+                                          const int radius)
+{
+    const int nw = BITBOARD_WORDS(size * size);
+    unsigned long long words[BITBOARD_WORDS(BITBOARD_BITS)];
+    int n = 0;
+
+    for (int w = 0; w < nw; w++) {
+        words[w] = __movegen_word(mg, w, size, radius);
+        n += bb_popcount(words[w]);
+    }
+    if (!n)
+        return -1;
+    int k = r % n;
+    for (int w = 0; w < nw; w++) {
+        int count = bb_popcount(words[w]);
+        if (k < count)
+            return (w << 6) + bb_select(words[w], k);
+        k -= count;
+    }
+    return -1; /* k < n, never reached */
+}
+
+#define DEFINE_GAME_VARIANT(S, G, R)                                         \
+    static_assert((S) <= MAX_BOARD_SIZE && (G) <= MAX_GOAL &&                \
+                  N_SEGMENTS_OF(S, G) <= MAX_SEGMENTS);                      \
+    static segment_t segments_##S##x##G[N_SEGMENTS_OF(S, G)];                \
+    static bitboard_t win_masks_##S##x##G[N_SEGMENTS_OF(S, G)];              \
+    static bitboard_t flank_masks_##S##x##G[N_SEGMENTS_OF(S, G)];            \
+    static grid_segment_t grid_segments_##S##x##G[(S) * (S)]                 \
+                                                 [MAX_GRID_SEGMENTS];        \
+    static int n_grid_segments_##S##x##G[(S) * (S)];                         \
+    static short grid_flanks_##S##x##G[(S) * (S)][MAX_GRID_FLANKS];          \
+    static int n_grid_flanks_##S##x##G[(S) * (S)];                           \
+    static struct game_variant variant_##S##x##G;                            \
+    static char check_win_##S##x##G(const char *t)                           \
+    {                                                                        \
+        return __check_win(&variant_##S##x##G, t, S, G);                     \
+    }                                                                        \
+    static char check_move_win_##S##x##G(const char *t, int move)            \
+    {                                                                        \
+        return __check_move_win(&variant_##S##x##G, t, move, G);             \
+    }                                                                        \
+    static int get_score_##S##x##G(const char *t, char player)               \
+    {                                                                        \
+        return __get_score(&variant_##S##x##G, t, player, S, G);             \
+    }                                                                        \
+    static int eval_move_delta_##S##x##G(const char *t, int move,            \
+                                         char player)                        \
+    {                                                                        \
+        return __eval_move_delta(&variant_##S##x##G, t, move, player, G);    \
+    }                                                                        \
+    static void movegen_init_##S##x##G(struct movegen *mg, const char *t)    \
+    {                                                                        \
+        __movegen_init(&variant_##S##x##G, mg, t, S, G, R);                  \
+    }                                                                        \
+    static void movegen_play_##S##x##G(struct movegen *mg, int move,         \
+                                       char player)                          \
+    {                                                                        \
+        __movegen_play(&variant_##S##x##G, mg, move, player, S, R);          \
+    }                                                                        \
+    static void movegen_undo_##S##x##G(struct movegen *mg, int move,         \
+                                       char player)                          \
+    {                                                                        \
+        __movegen_undo(&variant_##S##x##G, mg, move, player, S, R);          \
+    }                                                                        \
+    static int movegen_moves_##S##x##G(const struct movegen *mg, int *moves) \
+    {                                                                        \
+        return __movegen_moves(mg, moves, S, R);                             \
+    }                                                                        \
+    static int movegen_pick_##S##x##G(const struct movegen *mg,              \
+                                      unsigned long long r)                  \
+    {                                                                        \
+        return __movegen_pick(mg, r, S, R);                                  \
+    }                                                                        \
+    static const struct game_ops ops_##S##x##G = {                           \
+        .check_win = check_win_##S##x##G,                                    \
+        .check_move_win = check_move_win_##S##x##G,                          \
+        .get_score = get_score_##S##x##G,                                    \
+        .eval_move_delta = eval_move_delta_##S##x##G,                        \
+        .movegen_init = movegen_init_##S##x##G,                              \
+        .movegen_play = movegen_play_##S##x##G,                              \
+        .movegen_undo = movegen_undo_##S##x##G,                              \
+        .movegen_moves = movegen_moves_##S##x##G,                            \
+        .movegen_pick = movegen_pick_##S##x##G,                              \
+    };                                                                       \
+    static struct game_variant variant_##S##x##G = {                         \
+        .board_size = S,                                                     \
+        .goal = G,                                                           \
+        .n_grids = (S) * (S),                                                \
+        .n_segments = N_SEGMENTS_OF(S, G),                                   \
+        .candidate_radius = R,                                               \
+        .ops = &ops_##S##x##G,                                               \
+        .segments = segments_##S##x##G,                                      \
+        .win_masks = win_masks_##S##x##G,                                    \
+        .flank_masks = flank_masks_##S##x##G,                                \
+        .grid_segments = grid_segments_##S##x##G,                            \
+        .n_grid_segments = n_grid_segments_##S##x##G,                        \
+        .grid_flanks = grid_flanks_##S##x##G,                                \
+        .n_grid_flanks = n_grid_flanks_##S##x##G,                            \
+    }
+
+/* Board size, goal and candidate radius, 0 to try every empty grid */
+DEFINE_GAME_VARIANT(3, 3, 0);
+DEFINE_GAME_VARIANT(4, 3, 0);
+DEFINE_GAME_VARIANT(4, 4, 0);
+DEFINE_GAME_VARIANT(5, 4, 0);
+DEFINE_GAME_VARIANT(6, 5, 0);
+DEFINE_GAME_VARIANT(15, 5, 2);
+
+struct game_variant *const game_variants[] = {
+    &variant_3x3, &variant_4x3, &variant_4x4,
+    &variant_5x4, &variant_6x5, &variant_15x5,
+};
+const int n_game_variants = ARRAY_SIZE(game_variants);
+
+#define __VARIANT(S, G) variant_##S##x##G
+#define VARIANT(S, G) __VARIANT(S, G)
+
+/* Fails to build unless the default variant is one of the above */
+struct game_variant *game = &VARIANT(BOARD_SIZE, GOAL);
+
+struct game_variant *game_variant_find(int board_size, int goal)
+{
+    for (int i = 0; i < n_game_variants; i++)
+        if (game_variants[i]->board_size == board_size &&
+            game_variants[i]->goal == goal)
+            return game_variants[i];
+    return NULL;
 }
 
-char check_win(char *t)
+static void segments_init(struct game_variant *v)
 {
+    const int size = v->board_size, goal = v->goal;
+    const line_t lines[4] = {
+        {1, 0, 0, 0, size - goal + 1, size},                 // ROW
+        {0, 1, 0, 0, size, size - goal + 1},                 // COL
+        {1, 1, 0, 0, size - goal + 1, size - goal + 1},      // PRIMARY
+        {1, -1, 0, goal - 1, size - goal + 1, size},         // SECONDARY
+    };
+    int n = 0;
+
+    memset(v->n_grid_segments, 0, v->n_grids * sizeof(*v->n_grid_segments));
+    memset(v->n_grid_flanks, 0, v->n_grids * sizeof(*v->n_grid_flanks));
     for (int i_line = 0; i_line < 4; ++i_line) {
         line_t line = lines[i_line];
         for (int i = line.i_lower_bound; i < line.i_upper_bound; ++i) {
             for (int j = line.j_lower_bound; j < line.j_upper_bound; ++j) {
-                char win = check_line_segment_win(t, i, j, line);
-                if (win != ' ')
-                    return win;
+                bb_clear(&v->win_masks[n], BITBOARD_WORDS(BITBOARD_BITS));
+                bb_clear(&v->flank_masks[n], BITBOARD_WORDS(BITBOARD_BITS));
+                for (int k = 0; k < goal; k++) {
+                    int grid = (i + k * line.i_shift) * size +
+                               (j + k * line.j_shift);
+                    v->segments[n].grids[k] = grid;
+                    bb_set(&v->win_masks[n], grid);
+                    v->grid_segments[grid][v->n_grid_segments[grid]++] =
+                        (grid_segment_t){.segment = n, .offset = k};
+                }
+                for (int f = 0; f < 2; f++) {
+                    int k = f ? goal : -1;
+                    int fi = i + k * line.i_shift, fj = j + k * line.j_shift;
+                    int grid = fi * size + fj;
+                    v->segments[n].flanks[f] = -1;
+                    if (fi < 0 || fi >= size || fj < 0 || fj >= size)
+                        continue;
+                    v->segments[n].flanks[f] = grid;
+                    bb_set(&v->flank_masks[n], grid);
+                    v->grid_flanks[grid][v->n_grid_flanks[grid]++] = n;
+                }
+                n++;
             }
         }
     }
-    for (int i = 0; i < N_GRIDS; i++)
-        if (t[i] == ' ')
-            return ' ';
-    return 'D';
 }
 
 fixed_point_t calculate_win_value(char win, char player)
@@ -56,14 +498,67 @@ fixed_point_t calculate_win_value(char win, char player)
     return 1U << (FIXED_SCALE_BITS - 1);
 }
 
-int *available_moves(const char *table)
+void pattern_weights_reset(struct game_variant *v)
+{
+    for (int mask = 0; mask < n_patterns(v); mask++) {
+        int weight = 0;
+        for (int k = 0; k < v->goal; k++)
+            if (mask & (1 << k))
+                weight = weight ? weight * 10 : 1;
+        v->pattern_weights[mask] = weight;
+    }
+}
+
+void pattern_table_update(struct game_variant *v)
+{
+    for (int own = 0; own < n_patterns(v); own++) {
+        for (int opponent = 0; opponent < n_patterns(v); opponent++) {
+            int score = 0;
+            if (!opponent)
+                score = v->pattern_weights[own];
+            else if (!own)
+                score = -v->pattern_weights[opponent];
+            v->pattern_score[own][opponent] = score;
+        }
+    }
+}
+
+#ifdef __KERNEL__
+DEFINE_STATIC_CALL_NULL(game_check_move_win, *game->ops->check_move_win);
+DEFINE_STATIC_CALL_NULL(game_eval_move_delta, *game->ops->eval_move_delta);
+DEFINE_STATIC_CALL_NULL(game_movegen_play, *game->ops->movegen_play);
+DEFINE_STATIC_CALL_NULL(game_movegen_undo, *game->ops->movegen_undo);
+DEFINE_STATIC_CALL_NULL(game_movegen_moves, *game->ops->movegen_moves);
+DEFINE_STATIC_CALL_NULL(game_movegen_pick, *game->ops->movegen_pick);
+
+/* Patching text sleeps, so this runs in process context with preemption
+ * enabled, before a search is started. The searches are serialized and the
+ * variant is only switched between games, so that no search runs the static
+ * calls meanwhile.
+ */
+void game_ops_select(void)
 {
-    int *moves = kzalloc(N_GRIDS * sizeof(int), GFP_KERNEL);
-    int m = 0;
-    for (int i = 0; i < N_GRIDS; i++)
-        if (table[i] == ' ')
-            moves[m++] = i;
-    if (m < N_GRIDS)
-        moves[m] = -1;
-    return moves;
+    static const struct game_ops *selected;
+    const struct game_ops *ops = READ_ONCE(game)->ops;
+
+    if (ops == selected)
+        return;
+    static_call_update(game_check_move_win, ops->check_move_win);
+    static_call_update(game_eval_move_delta, ops->eval_move_delta);
+    static_call_update(game_movegen_play, ops->movegen_play);
+    static_call_update(game_movegen_undo, ops->movegen_undo);
+    static_call_update(game_movegen_moves, ops->movegen_moves);
+    static_call_update(game_movegen_pick, ops->movegen_pick);
+    selected = ops;
+}
+#endif
+
+void game_init(void)
+{
+    for (int i = 0; i < n_game_variants; i++) {
+        segments_init(game_variants[i]);
+        pattern_weights_reset(game_variants[i]);
+        pattern_table_update(game_variants[i]);
+    }
+    game_ops_select();
 }
@@ -1,17 +1,27 @@
 #pragma once
 
+#ifdef __KERNEL__
+#include <linux/static_call.h>
+#else
+#include <stdbool.h>
+#endif
+
+#include "bitboard.h"
+
+/* Default variant: the one a game starts with, and the one the userspace
+ * tools, the opening book and the network evaluator are built for. The
+ * module plays any of the variants in game.c, see struct game_variant.
+ */
 #define BOARD_SIZE 4
 #define GOAL 3
+#ifndef ALLOW_EXCEED
 #define ALLOW_EXCEED 1
+#endif
 #define N_GRIDS (BOARD_SIZE * BOARD_SIZE)
 #define GET_INDEX(i, j) ((i) * (BOARD_SIZE) + (j))
 #define GET_COL(x) ((x) % BOARD_SIZE)
 #define GET_ROW(x) ((x) / BOARD_SIZE)
 
-#define for_each_empty_grid(i, table) \
-    for (int i = 0; i < N_GRIDS; i++) \
-        if (table[i] == ' ')
-
 typedef struct {
     int i_shift, j_shift;
     int i_lower_bound, j_lower_bound, i_upper_bound, j_upper_bound;
@@ -27,13 +37,181 @@ typedef struct {
 #define CLR_SIGN(x) ((x) & ((1U << 31) - 1U))
 typedef unsigned fixed_point_t;
 
+/* Largest variant, which sizes every buffer holding a board */
+#define MAX_BOARD_SIZE 15
+#define MAX_GOAL 5
+#define MAX_GRIDS (MAX_BOARD_SIZE * MAX_BOARD_SIZE)
+
+/* Two newlines, then every row followed by a line of dashes, then a NUL so
+ * that a smaller board leaves the rest of the buffer empty.
+ */
 #define DRAW_SIZE (N_GRIDS + BOARD_SIZE)
-#define DRAWBUFFER_SIZE                                                 \
-    ((BOARD_SIZE * (BOARD_SIZE + 1) << 1) + (BOARD_SIZE * BOARD_SIZE) + \
-     ((BOARD_SIZE << 1) + 1) + 1)
+#define DRAWBUFFER_SIZE ((MAX_GRIDS << 2) + 3)
+
+/* Every line segment of goal grids, with the segments running through each
+ * grid and the offset of the grid within them. Without ALLOW_EXCEED, a line
+ * only wins if neither of the two grids flanking it, the grids extending it
+ * on both ends, holds a stone of the same player. Every grid then also knows
+ * the segments it flanks.
+ */
+#define N_SEGMENTS_OF(size, goal)                      \
+    (((size) * ((size) - (goal) + 1) +                 \
+      ((size) - (goal) + 1) * ((size) - (goal) + 1)) << 1)
+#define MAX_SEGMENTS N_SEGMENTS_OF(MAX_BOARD_SIZE, MAX_GOAL)
+#define MAX_GRID_SEGMENTS (MAX_GOAL << 2)
+#define MAX_GRID_FLANKS 8
+#define MAX_PATTERNS (1 << MAX_GOAL)
+
+typedef struct {
+    unsigned char grids[MAX_GOAL];
+    short flanks[2]; /* -1 past the edge of the board */
+} segment_t;
+
+typedef struct {
+    short segment;
+    short offset;
+} grid_segment_t;
+
+/* Moves a search may try, kept up to date as stones are played and taken
+ * back. Small variants try every empty grid. Large ones only try the empty
+ * grids within candidate_radius rows and columns of a stone, counted in
+ * n_near[], and the center on an empty board.
+ *
+ * blocked[p][s] counts what keeps player p ('O' for 0, 'X' for 1) from
+ * completing segment s: opponent stones in it and, without ALLOW_EXCEED,
+ * stones of p flanking it. n_open[p] counts the segments still open for p,
+ * the position is dead once neither player has any. Only the small variants
+ * keep these counts.
+ */
+struct movegen {
+    bitboard_t occupied;
+    bitboard_t near;
+    int n_stones;
+    int n_open[2];
+    unsigned char n_near[MAX_GRIDS];
+    unsigned char blocked[2][MAX_SEGMENTS];
+};
+
+/* Hot primitives of a variant, specialized for its size and goal */
+struct game_ops {
+    char (*check_win)(const char *table);
+    char (*check_move_win)(const char *table, int move);
+    int (*get_score)(const char *table, char player);
+    int (*eval_move_delta)(const char *table, int move, char player);
+    void (*movegen_init)(struct movegen *mg, const char *table);
+    void (*movegen_play)(struct movegen *mg, int move, char player);
+    void (*movegen_undo)(struct movegen *mg, int move, char player);
+    int (*movegen_moves)(const struct movegen *mg, int *moves);
+    int (*movegen_pick)(const struct movegen *mg, unsigned long long r);
+};
+
+/* A (board size, goal) combination, with tables sized for it. The pattern
+ * weights of the evaluation are kept per variant, see util.h.
+ */
+struct game_variant {
+    int board_size;
+    int goal;
+    int n_grids;
+    int n_segments;
+    int candidate_radius;
+    const struct game_ops *ops;
+    segment_t *segments;
+    bitboard_t *win_masks;
+    bitboard_t *flank_masks;
+    grid_segment_t (*grid_segments)[MAX_GRID_SEGMENTS];
+    int *n_grid_segments;
+    short (*grid_flanks)[MAX_GRID_FLANKS];
+    int *n_grid_flanks;
+    int pattern_weights[MAX_PATTERNS];
+    int pattern_score[MAX_PATTERNS][MAX_PATTERNS];
+};
+
+/* Variant of the game in progress, only switched between games */
+extern struct game_variant *game;
+extern struct game_variant *const game_variants[];
+extern const int n_game_variants;
+
+struct game_variant *game_variant_find(int board_size, int goal);
+void game_init(void);
+
+/* The primitives called at every move of a search go through static calls,
+ * direct calls patched by game_ops_select() before a search on another
+ * variant than the previous one. Only the searches may use GAME_OP(), as the
+ * variant may have been switched since.
+ */
+#ifdef __KERNEL__
+void game_ops_select(void);
+
+DECLARE_STATIC_CALL(game_check_move_win, *game->ops->check_move_win);
+DECLARE_STATIC_CALL(game_eval_move_delta, *game->ops->eval_move_delta);
+DECLARE_STATIC_CALL(game_movegen_play, *game->ops->movegen_play);
+DECLARE_STATIC_CALL(game_movegen_undo, *game->ops->movegen_undo);
+DECLARE_STATIC_CALL(game_movegen_moves, *game->ops->movegen_moves);
+DECLARE_STATIC_CALL(game_movegen_pick, *game->ops->movegen_pick);
+
+#define GAME_OP(op) static_call(game_##op)
+#else
+static inline void game_ops_select(void) {}
+
+#define GAME_OP(op) (game->ops->op)
+#endif
+
+static inline char check_win(const char *t)
+{
+    return game->ops->check_win(t);
+}
+
+/* Whether no line can be completed anymore, a draw whatever is played */
+static inline bool movegen_dead(const struct movegen *mg)
+{
+    return !mg->n_open[0] && !mg->n_open[1];
+}
+
+/* check_win() of a position whose last stone was played on move, or of any
+ * position for a move of -1, where mg matches the position. A dead position
+ * is a draw before the board is full.
+ */
+static inline char check_win_after(const char *t,
+                                   const struct movegen *mg,
+                                   int move)
+{
+    char win;
+
+    if (move == -1)
+        return check_win(t);
+    win = GAME_OP(check_move_win)(t, move);
+    if (win == ' ' && (mg->n_stones == game->n_grids || movegen_dead(mg)))
+        return 'D';
+    return win;
+}
+
+static inline void movegen_init(struct movegen *mg, const char *table)
+{
+    game->ops->movegen_init(mg, table);
+}
+
+static inline void movegen_play(struct movegen *mg, int move, char player)
+{
+    GAME_OP(movegen_play)(mg, move, player);
+}
+
+static inline void movegen_undo(struct movegen *mg, int move, char player)
+{
+    GAME_OP(movegen_undo)(mg, move, player);
+}
+
+/* Stores the candidate moves into moves, in increasing order, and returns
+ * their number.
+ */
+static inline int movegen_moves(const struct movegen *mg, int *moves)
+{
+    return GAME_OP(movegen_moves)(mg, moves);
+}
 
-extern const line_t lines[4];
+/* The (r % n)-th of the n candidate moves, or -1 without any */
+static inline int movegen_pick(const struct movegen *mg, unsigned long long r)
+{
+    return GAME_OP(movegen_pick)(mg, r);
+}
 
-int *available_moves(const char *table);
-char check_win(char *t);
 fixed_point_t calculate_win_value(char win, char player);
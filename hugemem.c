@@ -0,0 +1,147 @@
+#include <linux/gfp.h>
+#include <linux/mm.h>
+#include <linux/moduleparam.h>
+#include <linux/nodemask.h>
+#include <linux/printk.h>
+#include <linux/topology.h>
+#include <linux/vmalloc.h>
+#include <linux/version.h>
+
+#include "hugemem.h"
+
+/* Largest order alloc_pages() serves, inclusive since 6.4 */
+#if LINUX_VERSION_CODE >= KERNEL_VERSION(6, 8, 0)
+#define HUGE_MAX_ORDER MAX_PAGE_ORDER
+#elif LINUX_VERSION_CODE >= KERNEL_VERSION(6, 4, 0)
+#define HUGE_MAX_ORDER MAX_ORDER
+#else
+#define HUGE_MAX_ORDER (MAX_ORDER - 1)
+#endif
+
+static int search_node = NUMA_NO_NODE;
+module_param(search_node, int, 0444);
+MODULE_PARM_DESC(search_node,
+                 "NUMA node running the searches and holding their tables, "
+                 "-1 for the node loading the module");
+
+/* Settles the node before any table is allocated */
+void huge_numa_init(void)
+{
+    if (search_node < 0 || search_node >= MAX_NUMNODES ||
+        !node_online(search_node))
+        search_node = numa_node_id();
+    pr_info("kmldrv: searches run on NUMA node %d\n", search_node);
+}
+
+int huge_numa_node(void)
+{
+    return search_node;
+}
+
+/* Returns 0 with r holding size zeroed bytes, or -ENOMEM */
+int huge_alloc(struct huge_region *r, size_t size)
+{
+    unsigned int order = get_order(size);
+
+    r->size = size;
+    if (order <= HUGE_MAX_ORDER) {
+        struct page *page =
+            alloc_pages_node(search_node,
+                             GFP_KERNEL | __GFP_ZERO | __GFP_NOWARN |
+                                 __GFP_NORETRY | __GFP_COMP,
+                             order);
+        if (page) {
+            r->addr = page_address(page);
+            r->kind = HUGE_PAGES;
+            return 0;
+        }
+    }
+    r->addr = NULL;
+#if LINUX_VERSION_CODE >= KERNEL_VERSION(5, 18, 0)
+    /* vmalloc_huge() takes the pages of the node it is called on, another
+     * node has to do with base pages.
+     */
+    if (search_node == numa_node_id()) {
+        r->addr = vmalloc_huge(size, GFP_KERNEL | __GFP_ZERO);
+        r->kind = HUGE_VMALLOC;
+    }
+#endif
+    if (!r->addr) {
+        r->addr = vzalloc_node(size, search_node);
+        r->kind = HUGE_VMALLOC_SMALL;
+    }
+    if (!r->addr) {
+        r->size = 0;
+        r->kind = HUGE_NONE;
+        return -ENOMEM;
+    }
+    return 0;
+}
+
+void huge_free(struct huge_region *r)
+{
+    if (r->kind == HUGE_PAGES)
+        free_pages((unsigned long) r->addr, get_order(r->size));
+    else if (r->kind != HUGE_NONE)
+        vfree(r->addr);
+    r->addr = NULL;
+    r->kind = HUGE_NONE;
+}
+
+const char *huge_kind_name(const struct huge_region *r)
+{
+    static const char *const names[] = {
+        [HUGE_NONE] = "none",
+        [HUGE_PAGES] = "contiguous pages",
+        [HUGE_VMALLOC] = "vmalloc, huge mappings",
+        [HUGE_VMALLOC_SMALL] = "vmalloc",
+    };
+    return names[r->kind];
+}
+
+int arena_init(struct arena *a, size_t size)
+{
+    arena_reset(a);
+    return huge_alloc(&a->region, size);
+}
+
+void arena_exit(struct arena *a)
+{
+    huge_free(&a->region);
+    arena_reset(a);
+}
+
+static unsigned int game_arena_mb = 32;
+module_param(game_arena_mb, uint, 0444);
+MODULE_PARM_DESC(game_arena_mb, "Size of the engine memory of a game in MiB");
+
+struct arena game_arena;
+
+int game_arena_init(void)
+{
+    int ret = arena_init(&game_arena, (size_t) game_arena_mb << 20);
+
+    if (ret)
+        pr_err("kmldrv: no memory for the %u MiB game arena\n",
+               game_arena_mb);
+    else
+        pr_info("kmldrv: %u MiB game arena from %s\n", game_arena_mb,
+                huge_kind_name(&game_arena.region));
+    return ret;
+}
+
+void game_arena_exit(void)
+{
+    arena_exit(&game_arena);
+}
+
+/* Returns the most memory the engines held at once during the game. No
+ * search may be running.
+ */
+size_t game_arena_end(void)
+{
+    size_t peak = game_arena.peak;
+
+    arena_reset(&game_arena);
+    return peak;
+}
@@ -0,0 +1,83 @@
+#pragma once
+
+#include <linux/kernel.h>
+#include <linux/string.h>
+#include <linux/types.h>
+
+/* Large search tables, taken from physically contiguous pages where the
+ * allocator has them, which the kernel maps with huge pages, then from
+ * vmalloc with huge mappings, then from plain vmalloc. A random probe of a
+ * table then needs one TLB entry per huge page instead of one per page.
+ *
+ * All of them are placed on the NUMA node whose CPUs run the searches, so
+ * that no probe crosses the interconnect.
+ */
+enum huge_kind {
+    HUGE_NONE,
+    HUGE_PAGES, /* alloc_pages(), in the linear map */
+    HUGE_VMALLOC, /* vmalloc_huge() */
+    HUGE_VMALLOC_SMALL, /* vmalloc() with base pages */
+};
+
+struct huge_region {
+    void *addr;
+    size_t size;
+    enum huge_kind kind;
+};
+
+void huge_numa_init(void);
+int huge_numa_node(void);
+int huge_alloc(struct huge_region *r, size_t size);
+void huge_free(struct huge_region *r);
+const char *huge_kind_name(const struct huge_region *r);
+
+/* Bump allocator over a region. Everything allocated since a mark goes at
+ * once with arena_release(), everything at all with arena_reset().
+ */
+struct arena {
+    struct huge_region region;
+    size_t used;
+    size_t peak; /* most used since the last arena_reset() */
+};
+
+int arena_init(struct arena *a, size_t size);
+void arena_exit(struct arena *a);
+
+/* Zeroed memory, or NULL once the arena is full */
+static inline void *arena_alloc(struct arena *a, size_t size)
+{
+    size = ALIGN(size, sizeof(long));
+    if (a->region.size - a->used < size)
+        return NULL;
+
+    void *p = (char *) a->region.addr + a->used;
+    a->used += size;
+    a->peak = max(a->peak, a->used);
+    memset(p, 0, size);
+    return p;
+}
+
+static inline size_t arena_mark(const struct arena *a)
+{
+    return a->used;
+}
+
+static inline void arena_release(struct arena *a, size_t mark)
+{
+    a->used = mark;
+}
+
+static inline void arena_reset(struct arena *a)
+{
+    a->used = a->peak = 0;
+}
+
+/* Engine memory of the game being played. The searches allocate from it
+ * instead of the slab, each one releasing its own memory when done, and the
+ * game as a whole is accounted for and released when it ends.
+ */
+extern struct arena game_arena;
+
+int game_arena_init(void);
+void game_arena_exit(void);
+size_t game_arena_end(void);
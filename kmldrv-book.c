@@ -0,0 +1,276 @@
+#include <getopt.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "book.h"
+
+/* kmldrv-book: generates opening_book.h by solving the game exhaustively.
+ *
+ * Every position is solved once with its value memoized under its base-3 key,
+ * from the perspective of the player to move: a win scores the number of
+ * empty grids left after the winning move, so that faster wins score higher,
+ * a loss scores the opposite and a draw 0. The book then holds the best move
+ * of every canonical position reachable within the first plies.
+ */
+
+#if N_GRIDS > 20
+#error "book keys need 3^N_GRIDS to fit in 32 bits"
+#endif
+
+#define N_SEGMENTS_MAX (N_GRIDS * 4)
+#define MEMO_OFFSET 64
+
+/* Same segments as segments_init() in game.c, for the default variant */
+static const line_t book_lines[4] = {
+    {1, 0, 0, 0, BOARD_SIZE - GOAL + 1, BOARD_SIZE},
+    {0, 1, 0, 0, BOARD_SIZE, BOARD_SIZE - GOAL + 1},
+    {1, 1, 0, 0, BOARD_SIZE - GOAL + 1, BOARD_SIZE - GOAL + 1},
+    {1, -1, 0, GOAL - 1, BOARD_SIZE - GOAL + 1, BOARD_SIZE},
+};
+
+/* Segments through each grid, as masks of the segment and of its two
+ * flanking grids, the latter only matters without ALLOW_EXCEED.
+ */
+static uint32_t win_masks[N_GRIDS][N_SEGMENTS_MAX];
+static uint32_t flank_masks[N_GRIDS][N_SEGMENTS_MAX];
+static int n_win_masks[N_GRIDS];
+static uint32_t pow3[N_GRIDS];
+static uint8_t *memo;
+
+struct book_position {
+    unsigned int key;
+    char table[N_GRIDS];
+};
+
+static struct book_position *book;
+static int n_book, book_capacity;
+
+static void masks_init(void)
+{
+    for (int i_line = 0; i_line < 4; ++i_line) {
+        line_t line = book_lines[i_line];
+        for (int i = line.i_lower_bound; i < line.i_upper_bound; ++i) {
+            for (int j = line.j_lower_bound; j < line.j_upper_bound; ++j) {
+                uint32_t mask = 0, flank = 0;
+                for (int k = 0; k < GOAL; k++)
+                    mask |= 1U << GET_INDEX(i + k * line.i_shift,
+                                            j + k * line.j_shift);
+                for (int k = -1; k <= GOAL; k += GOAL + 1) {
+                    int fi = i + k * line.i_shift, fj = j + k * line.j_shift;
+                    if (fi >= 0 && fi < BOARD_SIZE && fj >= 0 &&
+                        fj < BOARD_SIZE)
+                        flank |= 1U << GET_INDEX(fi, fj);
+                }
+                for (int g = 0; g < N_GRIDS; g++) {
+                    if (!(mask & (1U << g)))
+                        continue;
+                    win_masks[g][n_win_masks[g]] = mask;
+                    flank_masks[g][n_win_masks[g]++] = flank;
+                }
+            }
+        }
+    }
+    pow3[0] = 1;
+    for (int i = 1; i < N_GRIDS; i++)
+        pow3[i] = pow3[i - 1] * 3;
+}
+
+/* Whether the stones own, just played at grid, complete a line */
+static int wins(uint32_t own, int grid)
+{
+    for (int i = 0; i < n_win_masks[grid]; i++) {
+        if ((own & win_masks[grid][i]) != win_masks[grid][i])
+            continue;
+        if (ALLOW_EXCEED || !(own & flank_masks[grid][i]))
+            return 1;
+    }
+    return 0;
+}
+
+/* Value of a non-terminal position for the player to move, whose stones are
+ * own and whose digit in the key is digit.
+ */
+static int solve(uint32_t own, uint32_t opp, uint32_t key, int digit)
+{
+    if (memo[key])
+        return memo[key] - MEMO_OFFSET;
+
+    int empties = N_GRIDS - __builtin_popcount(own | opp);
+    int best = -N_GRIDS - 1;
+    for (int g = 0; g < N_GRIDS && best < empties; g++) {
+        if ((own | opp) & (1U << g))
+            continue;
+        int value;
+        if (wins(own | (1U << g), g))
+            value = empties;
+        else if (empties == 1)
+            value = 0;
+        else
+            value = -solve(opp, own | (1U << g), key + pow3[g] * digit,
+                           3 - digit);
+        if (value > best)
+            best = value;
+    }
+    memo[key] = best + MEMO_OFFSET;
+    return best;
+}
+
+static void table_to_bits(const char *table, uint32_t *o, uint32_t *x)
+{
+    *o = *x = 0;
+    for (int g = 0; g < N_GRIDS; g++) {
+        if (table[g] == 'O')
+            *o |= 1U << g;
+        else if (table[g] == 'X')
+            *x |= 1U << g;
+    }
+}
+
+/* Best move of a non-terminal position, the lowest grid among equals */
+static int best_move(const char *table, char player)
+{
+    uint32_t o, x, key = 0;
+    table_to_bits(table, &o, &x);
+    for (int g = 0; g < N_GRIDS; g++)
+        if (table[g] != ' ')
+            key += pow3[g] * (table[g] == 'O' ? 1 : 2);
+
+    uint32_t own = player == 'O' ? o : x, opp = player == 'O' ? x : o;
+    int digit = player == 'O' ? 1 : 2;
+    int empties = N_GRIDS - __builtin_popcount(o | x);
+    int best = -1, best_value = -N_GRIDS - 2;
+    for (int g = 0; g < N_GRIDS; g++) {
+        if ((o | x) & (1U << g))
+            continue;
+        int value;
+        if (wins(own | (1U << g), g))
+            value = empties;
+        else if (empties == 1)
+            value = 0;
+        else
+            value = -solve(opp, own | (1U << g), key + pow3[g] * digit,
+                           3 - digit);
+        if (value > best_value) {
+            best_value = value;
+            best = g;
+        }
+    }
+    return best;
+}
+
+static int book_contains(unsigned int key)
+{
+    for (int i = 0; i < n_book; i++)
+        if (book[i].key == key)
+            return 1;
+    return 0;
+}
+
+/* Collects the canonical positions with fewer than depth stones */
+static void collect(char *table, char player, int n_stones, int depth)
+{
+    if (n_stones >= depth)
+        return;
+
+    int sym;
+    unsigned int key = book_canonical_key(table, &sym);
+    if (book_contains(key))
+        return;
+    if (n_book == book_capacity) {
+        book_capacity = book_capacity ? book_capacity << 1 : 1024;
+        book = realloc(book, book_capacity * sizeof(*book));
+        if (!book) {
+            perror("realloc");
+            exit(1);
+        }
+    }
+    book[n_book].key = key;
+    for (int g = 0; g < N_GRIDS; g++)
+        book[n_book].table[symmetry_grid(sym, g)] = table[g];
+    n_book++;
+
+    uint32_t o, x;
+    for (int g = 0; g < N_GRIDS; g++) {
+        if (table[g] != ' ')
+            continue;
+        table[g] = player;
+        table_to_bits(table, &o, &x);
+        if (!wins(player == 'O' ? o : x, g) && n_stones + 1 < N_GRIDS)
+            collect(table, player ^ 'O' ^ 'X', n_stones + 1, depth);
+        table[g] = ' ';
+    }
+}
+
+static int cmp_position(const void *a, const void *b)
+{
+    unsigned int ka = ((const struct book_position *) a)->key;
+    unsigned int kb = ((const struct book_position *) b)->key;
+    return ka < kb ? -1 : ka > kb;
+}
+
+int main(int argc, char *argv[])
+{
+    int depth = 6;
+    int c;
+
+    while ((c = getopt(argc, argv, "d:h")) != -1) {
+        switch (c) {
+        case 'd':
+            depth = atoi(optarg);
+            break;
+        case 'h':
+        default:
+            printf(
+                "kmldrv-book : generates the kmldrv opening book on "
+                "stdout\n");
+            printf("Usage:\n\n");
+            printf("\t./kmldrv-book [arguments] > opening_book.h\n\n");
+            printf("Arguments:\n\n");
+            printf(
+                "\t-d plies - number of opening plies covered by the book "
+                "(default 6)\n");
+            return c == 'h' ? 0 : 1;
+        }
+    }
+
+    masks_init();
+    memo = calloc((size_t) pow3[N_GRIDS - 1] * 3, 1);
+    if (!memo) {
+        perror("calloc");
+        return 1;
+    }
+
+    char table[N_GRIDS];
+    memset(table, ' ', N_GRIDS);
+    collect(table, 'O', 0, depth);
+    qsort(book, n_book, sizeof(*book), cmp_position);
+
+    printf("/* Generated by kmldrv-book -d %d, do not edit */\n", depth);
+    printf("#pragma once\n\n");
+    printf("#define BOOK_BOARD_SIZE %d\n", BOARD_SIZE);
+    printf("#define BOOK_GOAL %d\n", GOAL);
+    printf("#define BOOK_ALLOW_EXCEED %d\n", ALLOW_EXCEED);
+    printf("#define BOOK_DEPTH %d\n\n", depth);
+    printf("#define BOOK_SIZE %d\n\n", n_book);
+    printf("static const unsigned int opening_book_keys[BOOK_SIZE] = {\n");
+    for (int i = 0; i < n_book; i++)
+        printf("%s0x%08x,%s", i % 6 ? " " : "    ", book[i].key,
+               i % 6 == 5 || i == n_book - 1 ? "\n" : "");
+    printf("};\n\n");
+    printf("static const unsigned char opening_book_moves[BOOK_SIZE] = {\n");
+    for (int i = 0; i < n_book; i++) {
+        int n_stones = 0;
+        for (int g = 0; g < N_GRIDS; g++)
+            n_stones += book[i].table[g] != ' ';
+        int move = best_move(book[i].table, (n_stones & 1) ? 'X' : 'O');
+        printf("%s%d,%s", i % 16 ? " " : "    ", move,
+               i % 16 == 15 || i == n_book - 1 ? "\n" : "");
+    }
+    printf("};\n");
+
+    free(book);
+    free(memo);
+    return 0;
+}
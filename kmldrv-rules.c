@@ -0,0 +1,357 @@
+#include <getopt.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* kmldrv-rules: checks the primitives of every variant against brute force.
+ *
+ * The specialized primitives of game.c are built in userspace and compared,
+ * along random games, with a reference that knows nothing of their tables:
+ * it scans every line of the board for runs of stones, and every window of
+ * goal grids for the patterns of the evaluation. A run of at least the goal
+ * wins, or of exactly the goal without ALLOW_EXCEED, which is also when a
+ * window flanked by a stone of the player holding it is worth nothing.
+ *
+ * Build it with -DALLOW_EXCEED=0 to check the exact rule, see "make check".
+ */
+#include "game.c"
+
+static const int directions[4][2] = {{1, 0}, {0, 1}, {1, 1}, {1, -1}};
+
+static unsigned long n_checks, n_mismatches;
+
+static bool on_board(const struct game_variant *v, int i, int j)
+{
+    return i >= 0 && i < v->board_size && j >= 0 && j < v->board_size;
+}
+
+/* Length of the run of stones of player through (i, j) along d */
+static int run_length(const struct game_variant *v,
+                      const char *t,
+                      int i,
+                      int j,
+                      const int *d,
+                      char player)
+{
+    int n = 0, size = v->board_size;
+
+    for (int k = 0; on_board(v, i + k * d[0], j + k * d[1]) &&
+                    t[(i + k * d[0]) * size + j + k * d[1]] == player;
+         k++)
+        n++;
+    for (int k = 1; on_board(v, i - k * d[0], j - k * d[1]) &&
+                    t[(i - k * d[0]) * size + j - k * d[1]] == player;
+         k++)
+        n++;
+    return n;
+}
+
+static bool run_wins(const struct game_variant *v, int n)
+{
+    return ALLOW_EXCEED ? n >= v->goal : n == v->goal;
+}
+
+static char ref_check_move_win(const struct game_variant *v,
+                               const char *t,
+                               int move)
+{
+    int i = move / v->board_size, j = move % v->board_size;
+
+    for (int d = 0; d < 4; d++)
+        if (run_wins(v, run_length(v, t, i, j, directions[d], t[move])))
+            return t[move];
+    return ' ';
+}
+
+static char ref_check_win(const struct game_variant *v, const char *t)
+{
+    bool full = true;
+
+    for (int move = 0; move < v->n_grids; move++) {
+        if (t[move] == ' ')
+            full = false;
+        else if (ref_check_move_win(v, t, move) != ' ')
+            return t[move];
+    }
+    return full ? 'D' : ' ';
+}
+
+static bool window_flanked(const struct game_variant *v,
+                           const char *t,
+                           int i,
+                           int j,
+                           const int *d,
+                           char player)
+{
+    for (int k = -1; k <= v->goal; k += v->goal + 1) {
+        int fi = i + k * d[0], fj = j + k * d[1];
+        if (on_board(v, fi, fj) && t[fi * v->board_size + fj] == player)
+            return true;
+    }
+    return false;
+}
+
+/* Loops over every window of goal grids, starting at (i, j) along d */
+#define for_each_window(v, i, j, d)                                           \
+    for (int d = 0; d < 4; d++)                                               \
+        for (int i = 0; i < (v)->board_size; i++)                             \
+            for (int j = 0; j < (v)->board_size; j++)                         \
+                if (on_board(v, i + ((v)->goal - 1) * directions[d][0],       \
+                             j + ((v)->goal - 1) * directions[d][1]))
+
+static void window_masks(const struct game_variant *v,
+                         const char *t,
+                         int i,
+                         int j,
+                         const int *d,
+                         char player,
+                         int *own,
+                         int *opponent)
+{
+    *own = *opponent = 0;
+    for (int k = 0; k < v->goal; k++) {
+        char c = t[(i + k * d[0]) * v->board_size + j + k * d[1]];
+        if (c == player)
+            *own |= 1 << k;
+        else if (c != ' ')
+            *opponent |= 1 << k;
+    }
+}
+
+static int ref_get_score(const struct game_variant *v,
+                         const char *t,
+                         char player)
+{
+    char other = player ^ 'O' ^ 'X';
+    int score = 0;
+
+    for_each_window(v, i, j, d) {
+        const int *dir = directions[d];
+        int own, opponent;
+
+        window_masks(v, t, i, j, dir, player, &own, &opponent);
+        if (own && opponent)
+            continue;
+        if (!ALLOW_EXCEED &&
+            ((own && window_flanked(v, t, i, j, dir, player)) ||
+             (opponent && window_flanked(v, t, i, j, dir, other))))
+            continue;
+        score += own ? v->pattern_weights[own]
+                     : -v->pattern_weights[opponent];
+    }
+    return score;
+}
+
+/* Windows player may still complete, as counted by movegen.n_open[] */
+static int ref_n_open(const struct game_variant *v, const char *t, char player)
+{
+    int n = 0;
+
+    for_each_window(v, i, j, d) {
+        int own, opponent;
+
+        window_masks(v, t, i, j, directions[d], player, &own, &opponent);
+        if (!opponent && (ALLOW_EXCEED ||
+                          !window_flanked(v, t, i, j, directions[d], player)))
+            n++;
+    }
+    return n;
+}
+
+static bool ref_candidate(const struct game_variant *v,
+                          const char *t,
+                          int n_stones,
+                          int move)
+{
+    int r = v->candidate_radius, size = v->board_size;
+    int i = move / size, j = move % size;
+
+    if (t[move] != ' ')
+        return false;
+    if (!r)
+        return true;
+    if (!n_stones)
+        return move == (size >> 1) * size + (size >> 1);
+    for (int di = -r; di <= r; di++)
+        for (int dj = -r; dj <= r; dj++)
+            if (on_board(v, i + di, j + dj) &&
+                t[(i + di) * size + j + dj] != ' ')
+                return true;
+    return false;
+}
+
+static void print_board(const struct game_variant *v, const char *t)
+{
+    for (int i = 0; i < v->board_size; i++)
+        fprintf(stderr, "  |%.*s|\n", v->board_size, t + i * v->board_size);
+}
+
+static void expect(const struct game_variant *v,
+                   const char *t,
+                   bool ok,
+                   const char *what,
+                   long got,
+                   long want)
+{
+    n_checks++;
+    if (ok)
+        return;
+    if (n_mismatches++ < 10) {
+        fprintf(stderr, "%dx%d: %s is %ld instead of %ld on\n",
+                v->board_size, v->goal, what, got, want);
+        print_board(v, t);
+    }
+}
+
+#define EXPECT_EQ(v, t, what, got, want) \
+    expect(v, t, (got) == (want), what, got, want)
+
+static void check_movegen(const struct game_variant *v,
+                          const char *t,
+                          const struct movegen *mg)
+{
+    int moves[MAX_GRIDS], n = v->ops->movegen_moves(mg, moves), k = 0;
+    int n_stones = 0;
+
+    for (int move = 0; move < v->n_grids; move++)
+        n_stones += t[move] != ' ';
+    EXPECT_EQ(v, t, "n_stones", mg->n_stones, n_stones);
+    for (int move = 0; move < v->n_grids; move++) {
+        bool candidate = ref_candidate(v, t, mg->n_stones, move);
+        bool listed = k < n && moves[k] == move;
+
+        EXPECT_EQ(v, t, "candidate", listed, candidate);
+        k += listed;
+    }
+    EXPECT_EQ(v, t, "number of candidates", n, k);
+    if (n) {
+        int r = rand();
+        EXPECT_EQ(v, t, "movegen_pick", v->ops->movegen_pick(mg, r),
+                  moves[r % n]);
+    }
+    if (v->candidate_radius)
+        return;
+    EXPECT_EQ(v, t, "n_open[O]", mg->n_open[0], ref_n_open(v, t, 'O'));
+    EXPECT_EQ(v, t, "n_open[X]", mg->n_open[1], ref_n_open(v, t, 'X'));
+    EXPECT_EQ(v, t, "movegen_dead", movegen_dead(mg),
+              !ref_n_open(v, t, 'O') && !ref_n_open(v, t, 'X'));
+}
+
+static void check_move(const struct game_variant *v, char *t, int move)
+{
+    for (char player = 'O'; player <= 'X'; player += 'X' - 'O') {
+        int before = ref_get_score(v, t, player), after;
+
+        t[move] = player;
+        after = ref_get_score(v, t, player);
+        t[move] = ' ';
+        EXPECT_EQ(v, t, "eval_move_delta",
+                  v->ops->eval_move_delta(t, move, player), after - before);
+    }
+}
+
+static void play_game(struct game_variant *v)
+{
+    char t[MAX_GRIDS];
+    struct movegen mg;
+    char player = 'O', win = ' ';
+
+    memset(t, ' ', v->n_grids);
+    v->ops->movegen_init(&mg, t);
+    while (win == ' ') {
+        int empty[MAX_GRIDS], n = 0, move;
+
+        for (int i = 0; i < v->n_grids; i++)
+            if (t[i] == ' ')
+                empty[n++] = i;
+        move = empty[rand() % n];
+        check_move(v, t, move);
+        check_move(v, t, empty[rand() % n]);
+
+        t[move] = player;
+        v->ops->movegen_play(&mg, move, player);
+        win = ref_check_win(v, t);
+        EXPECT_EQ(v, t, "check_move_win", v->ops->check_move_win(t, move),
+                  ref_check_move_win(v, t, move));
+        EXPECT_EQ(v, t, "check_win", v->ops->check_win(t), win);
+        EXPECT_EQ(v, t, "get_score(O)", v->ops->get_score(t, 'O'),
+                  ref_get_score(v, t, 'O'));
+        EXPECT_EQ(v, t, "get_score(X)", v->ops->get_score(t, 'X'),
+                  ref_get_score(v, t, 'X'));
+        check_movegen(v, t, &mg);
+        player ^= 'O' ^ 'X';
+    }
+
+    /* Taking the whole game back has to restore the empty board */
+    for (int i = 0; i < v->n_grids; i++) {
+        if (t[i] == ' ')
+            continue;
+        v->ops->movegen_undo(&mg, i, t[i]);
+        t[i] = ' ';
+    }
+    check_movegen(v, t, &mg);
+}
+
+/* Every other game uses random weights, the first weight is always 0 */
+static void weights_randomize(struct game_variant *v)
+{
+    v->pattern_weights[0] = 0;
+    for (int mask = 1; mask < n_patterns(v); mask++)
+        v->pattern_weights[mask] = rand() % 2001 - 1000;
+    pattern_table_update(v);
+}
+
+int main(int argc, char *argv[])
+{
+    int n_games = 200;
+    unsigned int seed = 1;
+    int c;
+
+    while ((c = getopt(argc, argv, "g:s:h")) != -1) {
+        switch (c) {
+        case 'g':
+            n_games = atoi(optarg);
+            break;
+        case 's':
+            seed = strtoul(optarg, NULL, 0);
+            break;
+        case 'h':
+        default:
+            printf(
+                "kmldrv-rules : checks the game primitives against brute "
+                "force\n");
+            printf("Usage:\n\n");
+            printf("\t./kmldrv-rules [arguments]\n\n");
+            printf("Arguments:\n\n");
+            printf("\t-g n - number of random games per variant (default "
+                   "200)\n");
+            printf("\t-s seed - seed of the random games (default 1)\n\n");
+            printf("Exits with 1 if any primitive disagrees.\n");
+            return c == 'h' ? 0 : 1;
+        }
+    }
+
+    srand(seed);
+    game_init();
+    printf("ALLOW_EXCEED=%d\n", ALLOW_EXCEED);
+    for (int i = 0; i < n_game_variants; i++) {
+        struct game_variant *v = game_variants[i];
+        unsigned long checks = n_checks, mismatches = n_mismatches;
+
+        for (int g = 0; g < n_games; g++) {
+            if (g & 1) {
+                weights_randomize(v);
+            } else {
+                pattern_weights_reset(v);
+                pattern_table_update(v);
+            }
+            play_game(v);
+        }
+        pattern_weights_reset(v);
+        pattern_table_update(v);
+        printf("%2dx%d: %d games, %lu checks, %lu mismatches\n",
+               v->board_size, v->goal, n_games, n_checks - checks,
+               n_mismatches - mismatches);
+    }
+    return n_mismatches ? 1 : 0;
+}
@@ -0,0 +1,150 @@
+#include <getopt.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "tree_dump.h"
+
+/* kmldrv-tree: converts the MCTS tree snapshot of the module, see
+ * tree_dump.h, to Graphviz DOT or to JSON.
+ */
+
+static struct tree_dump_header header;
+static struct tree_dump_node *nodes;
+
+static double mean(const struct tree_dump_node *node, unsigned int value)
+{
+    return (double) value / (1U << header.scale_bits) /
+           (node->n_visits ? node->n_visits : 1);
+}
+
+static const char *result_label(char result)
+{
+    switch (result) {
+    case 'O':
+        return " O wins";
+    case 'X':
+        return " X wins";
+    case 'D':
+        return " draw";
+    }
+    return "";
+}
+
+/* Returns the index of the node after the subtree of node i */
+static unsigned int print_dot(unsigned int i)
+{
+    const struct tree_dump_node *node = &nodes[i];
+    unsigned int next = i + 1;
+
+    if (node->move == TREE_DUMP_NO_MOVE)
+        printf("    n%u [label=\"root %c\\n%u visits\"];\n", i, header.player,
+               node->n_visits);
+    else
+        printf(
+            "    n%u [label=\"(%d, %d)%s\\n%u visits\\nvalue %.3f prior "
+            "%.3f\"];\n",
+            i, node->move / header.board_size, node->move % header.board_size,
+            result_label(node->result), node->n_visits,
+            mean(node, node->score),
+            (double) node->prior / (1U << header.scale_bits));
+    for (int c = 0; c < node->n_children; c++) {
+        printf("    n%u -> n%u;\n", i, next);
+        next = print_dot(next);
+    }
+    return next;
+}
+
+static unsigned int print_json(unsigned int i, int indent)
+{
+    const struct tree_dump_node *node = &nodes[i];
+    unsigned int next = i + 1;
+
+    printf("%*s{\"move\": %d, \"visits\": %u, \"value\": %.4f, ", indent, "",
+           node->move == TREE_DUMP_NO_MOVE ? -1 : node->move, node->n_visits,
+           mean(node, node->score));
+    printf("\"prior\": %.4f, \"result\": \"%c\", \"children\": [",
+           (double) node->prior / (1U << header.scale_bits), node->result);
+    for (int c = 0; c < node->n_children; c++) {
+        printf("%s\n", c ? "," : "");
+        next = print_json(next, indent + 2);
+    }
+    printf(node->n_children ? "\n%*s]}" : "]}", indent, "");
+    return next;
+}
+
+/* Whether the children counts describe exactly n_nodes nodes */
+static int check_tree(void)
+{
+    unsigned long pending = 1;
+
+    for (unsigned int i = 0; i < header.n_nodes; i++) {
+        if (!pending--)
+            return 0;
+        pending += nodes[i].n_children;
+    }
+    return !pending;
+}
+
+int main(int argc, char *argv[])
+{
+    const char *path = TREE_DUMP_FILE;
+    int json = 0;
+    int c;
+
+    while ((c = getopt(argc, argv, "f:jh")) != -1) {
+        switch (c) {
+        case 'f':
+            path = optarg;
+            break;
+        case 'j':
+            json = 1;
+            break;
+        case 'h':
+        default:
+            printf(
+                "kmldrv-tree : converts the kmldrv MCTS tree snapshot\n");
+            printf("Usage:\n\n");
+            printf("\t./kmldrv-tree [arguments] > tree.dot\n\n");
+            printf("Arguments:\n\n");
+            printf("\t-f file - snapshot to read (default %s)\n",
+                   TREE_DUMP_FILE);
+            printf("\t-j - print JSON instead of DOT\n\n");
+            printf(
+                "Snapshots are taken with the module parameter "
+                "tree_dump_depth above 0\n");
+            return c == 'h' ? 0 : 1;
+        }
+    }
+
+    FILE *fp = fopen(path, "rb");
+    if (!fp) {
+        perror(path);
+        return 1;
+    }
+    if (fread(&header, sizeof(header), 1, fp) != 1 ||
+        header.magic != TREE_DUMP_MAGIC ||
+        header.version != TREE_DUMP_VERSION) {
+        fprintf(stderr, "%s: not a tree snapshot\n", path);
+        return 1;
+    }
+    nodes = calloc(header.n_nodes ? header.n_nodes : 1, sizeof(*nodes));
+    if (!nodes ||
+        fread(nodes, sizeof(*nodes), header.n_nodes, fp) != header.n_nodes ||
+        !header.n_nodes || !check_tree()) {
+        fprintf(stderr, "%s: truncated or corrupted snapshot\n", path);
+        return 1;
+    }
+    fclose(fp);
+
+    if (json) {
+        print_json(0, 0);
+        printf("\n");
+    } else {
+        printf("digraph mcts {\n    node [shape=box];\n");
+        print_dot(0);
+        printf("}\n");
+    }
+    free(nodes);
+    return 0;
+}
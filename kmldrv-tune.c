@@ -0,0 +1,586 @@
+#include <getopt.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "game.h"
+#include "mlp.h"
+
+/* kmldrv-tune: Texel-style tuning of the pattern weights used by get_score().
+ *
+ * Every position of a set of game records is labelled with the final result
+ * of its game, and the weights are fitted so that a logistic function of the
+ * evaluation predicts that result. The evaluation is linear in the weights:
+ * eval = sum(w[mask] * (n_O[mask] - n_X[mask])), where n_P[mask] counts the
+ * segments holding the stones of player P only, at the offsets of mask.
+ *
+ * With -m, the same games train the network of mlp.h instead: its value head
+ * on the results and, with -P, its policy head on the moves played. Without
+ * -P the policy stays flat, which PUCT searches better than the priors of the
+ * greedy self-play moves. The network is trained in floating point on boards
+ * drawn under the symmetries of the square, then quantized to the blob.
+ */
+
+#define N_PATTERNS (1 << GOAL)
+#define MAX_POSITIONS (1 << 20)
+
+/* Same segments as segments_init() in game.c, for the default variant */
+static const line_t tune_lines[4] = {
+    {1, 0, 0, 0, BOARD_SIZE - GOAL + 1, BOARD_SIZE},
+    {0, 1, 0, 0, BOARD_SIZE, BOARD_SIZE - GOAL + 1},
+    {1, 1, 0, 0, BOARD_SIZE - GOAL + 1, BOARD_SIZE - GOAL + 1},
+    {1, -1, 0, GOAL - 1, BOARD_SIZE - GOAL + 1, BOARD_SIZE},
+};
+
+struct position {
+    signed char features[N_PATTERNS];
+    float result; /* 1 for an O win, 0 for an X win, 0.5 for a draw */
+};
+
+static struct position *positions;
+static int n_positions;
+static double weights[N_PATTERNS];
+
+/* A board of a game before one of its moves, for the network */
+struct sample {
+    char table[N_GRIDS];
+    char player; /* to move */
+    unsigned char move;
+    float result; /* for the player to move, as position.result */
+};
+
+static struct sample *samples;
+static int n_samples;
+static bool train_policy;
+
+static int reverse_mask(int mask)
+{
+    int r = 0;
+    for (int k = 0; k < GOAL; k++)
+        if (mask & (1 << k))
+            r |= 1 << (GOAL - 1 - k);
+    return r;
+}
+
+/* Returns 'O' or 'X' for a completed segment, ' ' otherwise */
+static char extract_features(const char *table, signed char *features)
+{
+    char win = ' ';
+    memset(features, 0, N_PATTERNS);
+    for (int i_line = 0; i_line < 4; ++i_line) {
+        line_t line = tune_lines[i_line];
+        for (int i = line.i_lower_bound; i < line.i_upper_bound; ++i) {
+            for (int j = line.j_lower_bound; j < line.j_upper_bound; ++j) {
+                int o = 0, x = 0;
+                for (int k = 0; k < GOAL; k++) {
+                    char c = table[GET_INDEX(i + k * line.i_shift,
+                                             j + k * line.j_shift)];
+                    if (c == 'O')
+                        o |= 1 << k;
+                    else if (c == 'X')
+                        x |= 1 << k;
+                }
+                if (o && x)
+                    continue;
+                if (o)
+                    features[o]++;
+                if (x)
+                    features[x]--;
+                if (o == N_PATTERNS - 1)
+                    win = 'O';
+                if (x == N_PATTERNS - 1)
+                    win = 'X';
+            }
+        }
+    }
+    return win;
+}
+
+static double evaluate(const signed char *features)
+{
+    double eval = 0;
+    for (int mask = 1; mask < N_PATTERNS; mask++)
+        eval += weights[mask] * features[mask];
+    return eval;
+}
+
+/* Records a game given as a sequence of moves, O moving first */
+static void add_game(const int *moves, int n_moves)
+{
+    char table[N_GRIDS];
+    char win = ' ';
+    int first = n_positions;
+
+    memset(table, ' ', N_GRIDS);
+    for (int i = 0; i < n_moves && win == ' '; i++) {
+        if (n_positions == MAX_POSITIONS)
+            break;
+        if (samples) {
+            struct sample *sample = &samples[n_samples++];
+            memcpy(sample->table, table, N_GRIDS);
+            sample->player = (i & 1) ? 'X' : 'O';
+            sample->move = moves[i];
+        }
+        table[moves[i]] = (i & 1) ? 'X' : 'O';
+        win = extract_features(table, positions[n_positions++].features);
+    }
+
+    float result = win == 'O' ? 1.0f : win == 'X' ? 0.0f : 0.5f;
+    for (int i = first; i < n_positions; i++)
+        positions[i].result = result;
+    for (int i = n_samples - (n_positions - first); i < n_samples; i++)
+        samples[i].result =
+            samples[i].player == 'O' ? result : 1.0f - result;
+}
+
+static int read_games(const char *path)
+{
+    FILE *fp = fopen(path, "r");
+    char line[1024];
+    int n_games = 0;
+
+    if (!fp) {
+        perror(path);
+        return -1;
+    }
+    while (fgets(line, sizeof(line), fp)) {
+        int moves[N_GRIDS], n_moves = 0;
+        char *tok = strtok(line, " \t\n");
+        while (tok && n_moves < N_GRIDS) {
+            int move = atoi(tok);
+            if (move < 0 || move >= N_GRIDS)
+                break;
+            moves[n_moves++] = move;
+            tok = strtok(NULL, " \t\n");
+        }
+        if (n_moves) {
+            add_game(moves, n_moves);
+            n_games++;
+        }
+    }
+    fclose(fp);
+    return n_games;
+}
+
+/* Self-play with the current weights: an immediate win when there is one,
+ * otherwise the greedy move, or a random one with probability epsilon.
+ */
+static void self_play(int n_games, double epsilon)
+{
+    for (int g = 0; g < n_games; g++) {
+        char table[N_GRIDS];
+        int moves[N_GRIDS], n_moves = 0;
+        char player = 'O';
+
+        memset(table, ' ', N_GRIDS);
+        while (n_moves < N_GRIDS) {
+            int best = -1;
+            double best_eval = -INFINITY;
+            int empty[N_GRIDS], n_empty = 0;
+            for (int i = 0; i < N_GRIDS; i++)
+                if (table[i] == ' ')
+                    empty[n_empty++] = i;
+
+            if ((double) rand() / RAND_MAX < epsilon) {
+                best = empty[rand() % n_empty];
+            } else {
+                for (int m = 0; m < n_empty; m++) {
+                    signed char features[N_PATTERNS];
+                    table[empty[m]] = player;
+                    char win = extract_features(table, features);
+                    double eval = evaluate(features);
+                    if (player == 'X')
+                        eval = -eval;
+                    if (win == player)
+                        eval = INFINITY;
+                    table[empty[m]] = ' ';
+                    if (eval > best_eval) {
+                        best_eval = eval;
+                        best = empty[m];
+                    }
+                }
+            }
+
+            table[best] = player;
+            moves[n_moves++] = best;
+            signed char features[N_PATTERNS];
+            if (extract_features(table, features) != ' ')
+                break;
+            player ^= 'O' ^ 'X';
+        }
+        add_game(moves, n_moves);
+    }
+}
+
+static double sigmoid(double x, double k)
+{
+    return 1.0 / (1.0 + exp(-k * x));
+}
+
+static double mean_error(double k)
+{
+    double error = 0;
+    for (int i = 0; i < n_positions; i++) {
+        double d = positions[i].result -
+                   sigmoid(evaluate(positions[i].features), k);
+        error += d * d;
+    }
+    return error / n_positions;
+}
+
+/* Gradient descent on the mean squared error, with the weights of a pattern
+ * and of its reversal kept equal.
+ */
+static void tune(double k, int epochs, double rate)
+{
+    for (int e = 0; e < epochs; e++) {
+        double grad[N_PATTERNS] = {0};
+        for (int i = 0; i < n_positions; i++) {
+            double s = sigmoid(evaluate(positions[i].features), k);
+            double g = (s - positions[i].result) * s * (1 - s) * k;
+            for (int mask = 1; mask < N_PATTERNS; mask++)
+                grad[mask] += g * positions[i].features[mask];
+        }
+        for (int mask = 1; mask < N_PATTERNS; mask++) {
+            double g = grad[mask] + grad[reverse_mask(mask)];
+            weights[mask] -= rate * g / n_positions;
+        }
+        if (e % 100 == 0)
+            fprintf(stderr, "epoch %d: error %.6f\n", e, mean_error(k));
+    }
+}
+
+/* The network of mlp.h in floating point, with the hidden layer clipped to
+ * [0, 1] where the module clips its activations to [0, 127].
+ */
+static struct {
+    float w1[MLP_INPUTS][MLP_HIDDEN];
+    float b1[MLP_HIDDEN];
+    float wv[MLP_HIDDEN];
+    float bv;
+    float wp[N_GRIDS][MLP_HIDDEN];
+    float bp[N_GRIDS];
+} net;
+
+static double frand(void)
+{
+    return (double) rand() / RAND_MAX;
+}
+
+/* Grid turned by one of the 8 symmetries of the square: a transposition for
+ * bit 0, then a flip of the rows for bit 1 and of the columns for bit 2.
+ */
+static int symmetric_grid(int grid, int sym)
+{
+    int i = GET_ROW(grid), j = GET_COL(grid);
+
+    if (sym & 1) {
+        int t = i;
+        i = j;
+        j = t;
+    }
+    if (sym & 2)
+        i = BOARD_SIZE - 1 - i;
+    if (sym & 4)
+        j = BOARD_SIZE - 1 - j;
+    return GET_INDEX(i, j);
+}
+
+/* Softmax cross entropy of the policy head against the move played, adding
+ * its gradient with respect to the activations to grad.
+ */
+static void policy_step(const char *table,
+                        const float *act,
+                        int target,
+                        float rate,
+                        float *grad)
+{
+    float logit[N_GRIDS], best = -INFINITY, sum = 0;
+
+    /* Softmax over the empty grids, shifted by the largest logit */
+    for (int i = 0; i < N_GRIDS; i++) {
+        if (table[i] != ' ')
+            continue;
+        logit[i] = net.bp[i];
+        for (int h = 0; h < MLP_HIDDEN; h++)
+            logit[i] += net.wp[i][h] * act[h];
+        best = fmaxf(best, logit[i]);
+    }
+    for (int i = 0; i < N_GRIDS; i++) {
+        if (table[i] != ' ')
+            continue;
+        logit[i] = expf(logit[i] - best);
+        sum += logit[i];
+    }
+    for (int i = 0; i < N_GRIDS; i++) {
+        if (table[i] != ' ')
+            continue;
+        float d = logit[i] / sum - (i == target);
+        for (int h = 0; h < MLP_HIDDEN; h++) {
+            grad[h] += d * net.wp[i][h];
+            net.wp[i][h] -= rate * d * act[h];
+        }
+        net.bp[i] -= rate * d;
+    }
+}
+
+/* One step of stochastic gradient descent on the cross entropy of the heads
+ * for sample turned by sym, returns the loss of the value head.
+ */
+static double net_step(const struct sample *sample, int sym, float rate)
+{
+    char table[N_GRIDS];
+    int inputs[N_GRIDS], n_inputs = 0;
+    float acc[MLP_HIDDEN], act[MLP_HIDDEN], grad[MLP_HIDDEN];
+
+    for (int i = 0; i < N_GRIDS; i++)
+        table[symmetric_grid(i, sym)] = sample->table[i];
+    memcpy(acc, net.b1, sizeof(acc));
+    for (int i = 0; i < N_GRIDS; i++) {
+        if (table[i] == ' ')
+            continue;
+        inputs[n_inputs] = (i << 1) | (table[i] != sample->player);
+        for (int h = 0; h < MLP_HIDDEN; h++)
+            acc[h] += net.w1[inputs[n_inputs]][h];
+        n_inputs++;
+    }
+    for (int h = 0; h < MLP_HIDDEN; h++)
+        act[h] = fminf(fmaxf(acc[h], 0), 1);
+
+    float z = net.bv;
+    for (int h = 0; h < MLP_HIDDEN; h++)
+        z += net.wv[h] * act[h];
+    float value = 1 / (1 + expf(-z)), dz = value - sample->result;
+    for (int h = 0; h < MLP_HIDDEN; h++) {
+        grad[h] = dz * net.wv[h];
+        net.wv[h] -= rate * dz * act[h];
+    }
+    net.bv -= rate * dz;
+    if (train_policy)
+        policy_step(table, act, symmetric_grid(sample->move, sym), rate, grad);
+
+    /* Clipped units pass no gradient */
+    for (int h = 0; h < MLP_HIDDEN; h++) {
+        if (acc[h] <= 0 || acc[h] >= 1)
+            continue;
+        net.b1[h] -= rate * grad[h];
+        for (int k = 0; k < n_inputs; k++)
+            net.w1[inputs[k]][h] -= rate * grad[h];
+    }
+
+    float v = fminf(fmaxf(value, 1e-6f), 1 - 1e-6f);
+    return -(sample->result * logf(v) + (1 - sample->result) * logf(1 - v));
+}
+
+static void net_train(int epochs, double rate)
+{
+    /* Small random weights, the hidden units starting unclipped */
+    for (int i = 0; i < MLP_INPUTS; i++)
+        for (int h = 0; h < MLP_HIDDEN; h++)
+            net.w1[i][h] = (frand() - 0.5) * 0.2;
+    for (int h = 0; h < MLP_HIDDEN; h++) {
+        net.b1[h] = 0.5;
+        net.wv[h] = (frand() - 0.5) * 0.2;
+        for (int i = 0; i < N_GRIDS && train_policy; i++)
+            net.wp[i][h] = (frand() - 0.5) * 0.2;
+    }
+
+    for (int e = 0; e < epochs; e++) {
+        double loss = 0;
+        for (int k = 0; k < n_samples; k++)
+            loss += net_step(&samples[rand() % n_samples], rand() & 7, rate);
+        fprintf(stderr, "epoch %d: value loss %.6f\n", e, loss / n_samples);
+    }
+}
+
+static void put_le(FILE *fp, long value, int size)
+{
+    for (int k = 0; k < size; k++)
+        fputc((value >> (k << 3)) & 0xff, fp);
+}
+
+static long quantize(double x, double scale, long limit)
+{
+    long q = lround(x * scale);
+    return q < -limit ? -limit : q > limit ? limit : q;
+}
+
+/* Writes the network as the blob of mlp.h. The activations of [0, 1] become
+ * [0, 127], the first layer keeps as many bits as an s16 holds and the heads
+ * as many as an s8 holds, with FIXED_SCALE_BITS fractional bits out.
+ */
+static int net_write(const char *path)
+{
+    double max_w1 = 0, max_head = fabs(net.bv) / 127;
+    int acc_shift = 15, out_shift = 31;
+
+    for (int h = 0; h < MLP_HIDDEN; h++) {
+        max_w1 = fmax(max_w1, fabs(net.b1[h]));
+        for (int i = 0; i < MLP_INPUTS; i++)
+            max_w1 = fmax(max_w1, fabs(net.w1[i][h]));
+        max_head = fmax(max_head, fabs(net.wv[h]));
+        for (int i = 0; i < N_GRIDS; i++)
+            max_head = fmax(max_head, fabs(net.wp[i][h]));
+    }
+    for (int i = 0; i < N_GRIDS; i++)
+        max_head = fmax(max_head, fabs(net.bp[i]) / 127);
+    while (acc_shift && max_w1 * 127 * (1 << acc_shift) > INT16_MAX)
+        acc_shift--;
+    /* The biases of the heads then stay far from the s32 limits */
+    while (out_shift &&
+           max_head * ldexp(1, FIXED_SCALE_BITS + out_shift) / 127 > INT8_MAX)
+        out_shift--;
+
+    double scale_w1 = 127.0 * (1 << acc_shift);
+    double scale_out = ldexp(1, FIXED_SCALE_BITS + out_shift);
+    FILE *fp = fopen(path, "wb");
+    if (!fp) {
+        perror(path);
+        return -1;
+    }
+    put_le(fp, MLP_MAGIC, 4);
+    put_le(fp, MLP_VERSION, 2);
+    put_le(fp, BOARD_SIZE, 1);
+    put_le(fp, MLP_HIDDEN, 1);
+    put_le(fp, acc_shift, 1);
+    put_le(fp, out_shift, 1);
+    put_le(fp, 0, 2);
+    for (int h = 0; h < MLP_HIDDEN; h++)
+        put_le(fp, quantize(net.b1[h], scale_w1, INT16_MAX), 2);
+    for (int i = 0; i < MLP_INPUTS; i++)
+        for (int h = 0; h < MLP_HIDDEN; h++)
+            put_le(fp, quantize(net.w1[i][h], scale_w1, INT16_MAX), 2);
+    put_le(fp, quantize(net.bv, scale_out, INT32_MAX), 4);
+    for (int h = 0; h < MLP_HIDDEN; h++)
+        put_le(fp, quantize(net.wv[h], scale_out / 127, INT8_MAX), 1);
+    for (int i = 0; i < N_GRIDS; i++)
+        put_le(fp, quantize(net.bp[i], scale_out, INT32_MAX), 4);
+    for (int i = 0; i < N_GRIDS; i++)
+        for (int h = 0; h < MLP_HIDDEN; h++)
+            put_le(fp, quantize(net.wp[i][h], scale_out / 127, INT8_MAX), 1);
+    if (fclose(fp)) {
+        perror(path);
+        return -1;
+    }
+    fprintf(stderr, "acc_shift %d, out_shift %d\n", acc_shift, out_shift);
+    return 0;
+}
+
+int main(int argc, char *argv[])
+{
+    const char *records = NULL, *network = NULL;
+    int n_games = 10000, epochs = -1;
+    double epsilon = 0.2, rate = -1, k = 0.1;
+    int c;
+
+    while ((c = getopt(argc, argv, "f:g:e:r:p:m:Ph")) != -1) {
+        switch (c) {
+        case 'f':
+            records = optarg;
+            break;
+        case 'm':
+            network = optarg;
+            break;
+        case 'P':
+            train_policy = true;
+            break;
+        case 'g':
+            n_games = atoi(optarg);
+            break;
+        case 'e':
+            epochs = atoi(optarg);
+            break;
+        case 'r':
+            rate = atof(optarg);
+            break;
+        case 'p':
+            epsilon = atof(optarg);
+            break;
+        case 'h':
+        default:
+            printf(
+                "kmldrv-tune : Texel-style tuner of the kmldrv pattern "
+                "weights\n");
+            printf("Usage:\n\n");
+            printf("\t./kmldrv-tune [arguments]\n\n");
+            printf("Arguments:\n\n");
+            printf(
+                "\t-f file - game records, one game per line as grid indices "
+                "with O moving first\n");
+            printf(
+                "\t-g n - number of self-play games without -f (default "
+                "10000)\n");
+            printf("\t-p eps - self-play exploration rate (default 0.2)\n");
+            printf("\t-e n - number of epochs (default 1000, 20 with -m)\n");
+            printf("\t-r rate - learning rate (default 100, 0.01 with -m)\n");
+            printf(
+                "\t-m file - train the network on the games instead, and "
+                "write its weights to file\n");
+            printf("\t-P - with -m, train the policy head on the moves "
+                   "played\n\n");
+            printf(
+                "The weights are printed in the format of "
+                "/sys/class/kmldrv/kmldrv/eval_weights, the network in the "
+                "layout of %s\n",
+                MLP_FIRMWARE);
+            return c == 'h' ? 0 : 1;
+        }
+    }
+
+    if (epochs < 0)
+        epochs = network ? 20 : 1000;
+    if (rate < 0)
+        rate = network ? 0.01 : 100.0;
+    positions = calloc(MAX_POSITIONS, sizeof(*positions));
+    if (network)
+        samples = calloc(MAX_POSITIONS, sizeof(*samples));
+    if (!positions || (network && !samples))
+        return 1;
+
+    /* Start from the weights of the module, 10^(k - 1) for k stones */
+    for (int mask = 1; mask < N_PATTERNS; mask++)
+        weights[mask] = pow(10, __builtin_popcount(mask) - 1);
+
+    if (records) {
+        if (read_games(records) < 0)
+            return 1;
+    } else {
+        srand(1);
+        self_play(n_games, epsilon);
+    }
+    if (!n_positions) {
+        fprintf(stderr, "No positions to tune on\n");
+        return 1;
+    }
+    fprintf(stderr, "%d positions\n", n_positions);
+
+    if (network) {
+        int ret;
+
+        net_train(epochs, rate);
+        ret = net_write(network);
+        free(samples);
+        free(positions);
+        return ret ? 1 : 0;
+    }
+
+    /* Scale the logistic function to the current weights first */
+    double best_error = INFINITY;
+    for (double kk = 0.001; kk < 1.0; kk *= 1.1) {
+        double error = mean_error(kk);
+        if (error < best_error) {
+            best_error = error;
+            k = kk;
+        }
+    }
+    fprintf(stderr, "K = %.4f, initial error %.6f\n", k, best_error);
+
+    tune(k, epochs, rate);
+
+    for (int mask = 0; mask < N_PATTERNS; mask++)
+        printf("%ld%c", lround(weights[mask]),
+               mask == N_PATTERNS - 1 ? '\n' : ' ');
+    free(positions);
+    return 0;
+}
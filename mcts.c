@@ -1,41 +1,157 @@
+#include <linux/bits.h>
+#include <linux/build_bug.h>
+#include <linux/jump_label.h>
+#include <linux/ktime.h>
+#include <linux/limits.h>
+#include <linux/math64.h>
+#include <linux/moduleparam.h>
+#include <linux/printk.h>
 #include <linux/sched/loadavg.h>
-#include <linux/slab.h>
 #include <linux/string.h>
 
+#include "analysis.h"
+#include "book.h"
 #include "game.h"
+#include "hugemem.h"
 #include "mcts.h"
+#include "mlp.h"
+#include "poscache.h"
+#include "tree_dump.h"
+#include "tss.h"
 #include "util.h"
-// #include "wyhash.h"
+#include "wyhash.h"
 
+/* The moves of a node are stored on expansion, sized to its branching. A
+ * child is only created on its first visit, in the order of moves[], and the
+ * children are linked from the last one created through sibling. Once all of
+ * them are created, their visits and scores are mirrored in arrays of the
+ * parent, indexed like moves[], so that select_move() scans them without
+ * touching the children.
+ */
 struct node {
     int move;
     char player;
     int n_visits;
     fixed_point_t score;
+    fixed_point_t prior;
     struct node *parent;
-    struct node *children[N_GRIDS];
+    struct node *children;
+    struct node *sibling;
+    u8 *moves;
+    struct node **child_nodes;
+    u32 *child_visits;
+    fixed_point_t *child_scores;
+    u8 n_children;
+    u8 n_created;
+    u8 index; /* in moves[] of the parent */
 };
 
+static_assert(MAX_GRIDS <= U8_MAX);
+
 static struct mcts_info mcts_obj;
+static struct analysis analysis;
+
+/* Candidate moves of the search in progress, kept up to date by playing and
+ * taking back the moves of every descent and playout, as a movegen is too
+ * large to be copied onto the stack.
+ */
+static struct movegen search_mg;
+static int playout_moves[MAX_GRIDS];
+static int expand_moves[MAX_GRIDS];
+
+static int leaf_eval = LEAF_EVAL_ROLLOUT;
+module_param(leaf_eval, int, 0644);
+MODULE_PARM_DESC(leaf_eval,
+                 "MCTS leaf evaluation: 0 = rollout, 1 = network, 2 = mixed");
+
+static int mcts_mode = MCTS_MODE_UCT;
+module_param(mcts_mode, int, 0644);
+MODULE_PARM_DESC(mcts_mode, "MCTS variant: 0 = UCT, 1 = PUCT with network");
+
+static unsigned int cache_min_share = 900;
+module_param(cache_min_share, uint, 0644);
+MODULE_PARM_DESC(cache_min_share,
+                 "Per mille of the root visits for an MCTS move to be cached");
+
+static unsigned int tree_dump_depth;
+module_param(tree_dump_depth, uint, 0644);
+MODULE_PARM_DESC(tree_dump_depth,
+                 "Depth of the MCTS tree snapshot in debugfs, 0 for none "
+                 "(at most 16)");
+
+static unsigned int tree_dump_visits = 1;
+module_param(tree_dump_visits, uint, 0644);
+MODULE_PARM_DESC(tree_dump_visits,
+                 "Fewest visits of a node in the MCTS tree snapshot");
+
+static bool select_bench;
+module_param(select_bench, bool, 0444);
+MODULE_PARM_DESC(select_bench, "Log the UCT selections per second at load");
+
+static bool playout_wyhash;
+module_param(playout_wyhash, bool, 0644);
+MODULE_PARM_DESC(playout_wyhash,
+                 "Draw the moves of MCTS playouts from wyhash, not xoroshiro");
+
+/* Follows playout_wyhash from one search to the next, so that the playouts
+ * test nothing but a patched jump.
+ */
+static DEFINE_STATIC_KEY_FALSE(playout_rng_wyhash);
+
+void playout_rng_select(void)
+{
+    bool wyhash = READ_ONCE(playout_wyhash);
+
+    if (wyhash == static_key_enabled(&playout_rng_wyhash))
+        return;
+    if (wyhash)
+        static_branch_enable(&playout_rng_wyhash);
+    else
+        static_branch_disable(&playout_rng_wyhash);
+}
+
+static u64 playout_rand(void)
+{
+    if (static_branch_unlikely(&playout_rng_wyhash))
+        return wyhash64();
+    return xoro_next(&mcts_obj.xoro_obj);
+}
+
+/* The tree of a search lives in the game arena, released in one go when
+ * the search is done. A tree that fills the arena stops growing.
+ */
+static void *node_alloc(size_t size)
+{
+    return arena_alloc(&game_arena, size);
+}
 
 static struct node *new_node(int move, char player, struct node *parent)
 {
-    struct node *node = kzalloc(sizeof(struct node), GFP_KERNEL);
+    struct node *node = node_alloc(sizeof(struct node));
+    if (!node)
+        return NULL;
     node->move = move;
     node->player = player;
     node->n_visits = 0;
     node->score = 0;
     node->parent = parent;
-    memset(node->children, 0, sizeof(node->children));
     return node;
 }
 
-static void free_node(struct node *node)
+/* Creates the next child of node that has never been visited, NULL once the
+ * arena is full.
+ */
+static struct node *add_child(struct node *node)
 {
-    for (int i = 0; i < N_GRIDS; i++)
-        if (node->children[i])
-            free_node(node->children[i]);
-    kfree(node);
+    struct node *child = new_node(node->moves[node->n_created],
+                                  node->player ^ 'O' ^ 'X', node);
+    if (!child)
+        return NULL;
+    child->index = node->n_created++;
+    child->sibling = node->children;
+    node->children = child;
+    mcts_obj.nr_active_nodes++;
+    return child;
 }
 
 fixed_point_t fixed_sqrt(fixed_point_t x)
@@ -85,66 +201,133 @@ fixed_point_t fixed_log(fixed_point_t v)
     return ans;
 }
 
-static inline fixed_point_t uct_score(int n_total,
-                                      int n_visits,
-                                      fixed_point_t score)
+/* UCT in fixed point is the score plus
+ * EXPLORATION_FACTOR * sqrt(log_total / n) for a child of n visits, where
+ * log_total is fixed_log() of the visits of the parent, which stays below
+ * UCT_LOG_MAX. The division is a multiplication by uct_recip[n], rounded up
+ * and corrected by one where it overshoots, and the square root with its
+ * factor is read from uct_explore[]. Beyond UCT_LOG_MAX visits the quotient
+ * is 0 whatever n.
+ */
+#define UCT_LOG_MAX 2048
+#define UCT_RECIP_BITS 21
+
+static u32 uct_recip[UCT_LOG_MAX];
+static u16 uct_explore[UCT_LOG_MAX];
+
+static void uct_init(void)
 {
-    if (n_visits == 0)
-        return FIXED_MAX;
+    fixed_point_t factor = EXPLORATION_FACTOR;
 
-    fixed_point_t result =
-        score << FIXED_SCALE_BITS /
-                     (fixed_point_t) (n_visits << FIXED_SCALE_BITS);
-    fixed_point_t tmp =
-        EXPLORATION_FACTOR *
-        fixed_sqrt(fixed_log(n_total << FIXED_SCALE_BITS) / n_visits);
-    tmp >>= FIXED_SCALE_BITS;
-    return result + tmp;
+    for (int n = 1; n < UCT_LOG_MAX; n++)
+        uct_recip[n] = DIV_ROUND_UP(1U << UCT_RECIP_BITS, n);
+    for (int q = 0; q < UCT_LOG_MAX; q++)
+        uct_explore[q] = (factor * fixed_sqrt(q)) >> FIXED_SCALE_BITS;
 }
 
+/* Mirrors the statistics of the children of a fully expanded node. Most
+ * nodes never get there, which keeps the arrays off them.
+ */
+static int pack_children(struct node *node)
+{
+    node->child_nodes =
+        node_alloc(node->n_children * (sizeof(struct node *) + sizeof(u32) +
+                                       sizeof(fixed_point_t)));
+    if (!node->child_nodes)
+        return -ENOMEM;
+    node->child_visits = (u32 *) (node->child_nodes + node->n_children);
+    node->child_scores = node->child_visits + node->n_children;
+    for (struct node *child = node->children; child; child = child->sibling) {
+        node->child_nodes[child->index] = child;
+        node->child_visits[child->index] = child->n_visits;
+        node->child_scores[child->index] = child->score;
+    }
+    return 0;
+}
+
+/* Scans the packed statistics of the children without a branch: each score
+ * is joined with the index of its child into one key, of which the largest
+ * wins. Equal scores go to the child created last, as they did when the
+ * children were scanned through sibling, and a score of 0 never wins.
+ */
 static struct node *select_move(struct node *node)
 {
-    struct node *best_node = NULL;
-    fixed_point_t best_score = 0U;
-    for (int i = 0; i < N_GRIDS; i++) {
-        if (!node->children[i])
-            continue;
-        fixed_point_t score =
-            uct_score(node->n_visits, node->children[i]->n_visits,
-                      node->children[i]->score);
-        if (score > best_score) {
-            best_score = score;
-            best_node = node->children[i];
-        }
+    u64 best = 0;
+
+    /* An unvisited child scores FIXED_MAX, the first of them is taken */
+    if (node->n_created < node->n_children)
+        return add_child(node);
+    if (!node->child_nodes && pack_children(node))
+        return node->children;
+    u32 log_total = min_t(u32, fixed_log(node->n_visits << FIXED_SCALE_BITS),
+                          UCT_LOG_MAX - 1);
+    const u32 *visits = node->child_visits;
+    const fixed_point_t *scores = node->child_scores;
+    for (int i = 0; i < node->n_created; i++) {
+        u32 n = min_t(u32, visits[i], UCT_LOG_MAX - 1);
+        u32 q = (log_total * uct_recip[n]) >> UCT_RECIP_BITS;
+        q -= q * n > log_total;
+        fixed_point_t score = scores[i] + uct_explore[q];
+        score |= -(fixed_point_t) !n;
+        best = max(best, (u64) score << BITS_PER_BYTE | i);
     }
-    return best_node;
+    if (!(best >> BITS_PER_BYTE))
+        return NULL;
+    return node->child_nodes[best & U8_MAX];
 }
 
-static fixed_point_t simulate(char *table, char player)
+/* Plays a random game out on table and mg, then takes it back */
+static fixed_point_t simulate(char *table, char player, struct movegen *mg)
 {
     char current_player = player;
-    char temp_table[N_GRIDS];
-    memcpy(temp_table, table, N_GRIDS);
+    fixed_point_t score = (fixed_point_t) (1UL << (FIXED_SCALE_BITS - 1));
+    int n_moves = 0;
     xoro_jump(&(mcts_obj.xoro_obj));
     while (1) {
-        int *moves = available_moves(temp_table);
-        if (moves[0] == -1) {
-            kfree(moves);
+        int move = movegen_pick(mg, playout_rand());
+        if (move == -1)
             break;
-        }
-        int n_moves = 0;
-        while (n_moves < N_GRIDS && moves[n_moves] != -1)
-            ++n_moves;
-        // int move = moves[wyhash64() % n_moves];
-        int move = moves[xoro_next(&(mcts_obj.xoro_obj)) % n_moves];
-        kfree(moves);
-        temp_table[move] = current_player;
+        table[move] = current_player;
+        movegen_play(mg, move, current_player);
+        playout_moves[n_moves++] = move;
         char win;
-        if ((win = check_win(temp_table)) != ' ')
-            return calculate_win_value(win, player);
+        if ((win = GAME_OP(check_move_win)(table, move)) != ' ') {
+            score = calculate_win_value(win, player);
+            break;
+        }
+        if (movegen_dead(mg))
+            break;
         current_player ^= 'O' ^ 'X';
     }
-    return (fixed_point_t) (1UL << (FIXED_SCALE_BITS - 1));
+    while (n_moves--) {
+        int move = playout_moves[n_moves];
+        movegen_undo(mg, move, table[move]);
+        table[move] = ' ';
+    }
+    return score;
+}
+
+/* A leaf that threat-space search already proved won for the player to
+ * move is not played out. Otherwise, falls back to rollouts as long as no
+ * network weights are loaded.
+ */
+static fixed_point_t evaluate_leaf(char *table,
+                                   char player,
+                                   struct movegen *mg,
+                                   const struct poscache_key *key)
+{
+    struct poscache_result cached;
+
+    if (poscache_probe_key(key, table, &cached) && cached.proven &&
+        cached.engine == POSCACHE_TSS)
+        return calculate_win_value(player, player);
+    if (leaf_eval == LEAF_EVAL_ROLLOUT || !mlp_ready())
+        return simulate(table, player, mg);
+
+    fixed_point_t value = mlp_value(table, player);
+    if (leaf_eval == LEAF_EVAL_MIXED)
+        value = (value + simulate(table, player, mg)) >> 1;
+    return value;
 }
 
 static void backpropagate(struct node *node, fixed_point_t score)
@@ -152,73 +335,448 @@ static void backpropagate(struct node *node, fixed_point_t score)
     while (node) {
         node->n_visits++;
         node->score += score;
+        if (node->parent && node->parent->child_nodes) {
+            node->parent->child_visits[node->index]++;
+            node->parent->child_scores[node->index] += score;
+        }
         node = node->parent;
         score = 1 - score;
     }
 }
 
-static int expand(struct node *node, char *table)
+static int expand(struct node *node, const struct movegen *mg)
 {
-    int *moves = available_moves(table);
-    int n_moves = 0;
-    while (n_moves < N_GRIDS && moves[n_moves] != -1)
-        ++n_moves;
-    for (int i = 0; i < n_moves; i++) {
-        node->children[i] = new_node(moves[i], node->player ^ 'O' ^ 'X', node);
-    }
-    kfree(moves);
+    int n_moves = movegen_moves(mg, expand_moves);
+    node->moves = node_alloc(n_moves);
+    if (!node->moves)
+        return 0;
+    for (int i = 0; i < n_moves; i++)
+        node->moves[i] = expand_moves[i];
+    node->n_children = n_moves;
     return n_moves;
 }
 
+/* PUCT: Q + C * P * sqrt(N) / (1 + n), where the pending visits of the
+ * virtual loss count in n and N without contributing to the score.
+ */
+static struct node *select_puct(struct node *node)
+{
+    struct node *best_node = NULL;
+    fixed_point_t best_score = 0U;
+    fixed_point_t sqrt_total = fixed_sqrt(node->n_visits << FIXED_SCALE_BITS);
+    for (struct node *child = node->children; child; child = child->sibling) {
+        fixed_point_t q = 0U;
+        if (child->n_visits)
+            q = child->score / child->n_visits;
+        fixed_point_t u = (PUCT_C * child->prior) >> FIXED_SCALE_BITS;
+        u = ((u * sqrt_total) >> FIXED_SCALE_BITS) / (1 + child->n_visits);
+        if (!best_node || q + u > best_score) {
+            best_score = q + u;
+            best_node = child;
+        }
+    }
+    return best_node;
+}
+
+/* Visits were already counted on the way down, only the value is added.
+ * node->score holds the value for the player who moved into the node.
+ */
+static void backpropagate_puct(struct node *node, fixed_point_t score)
+{
+    while (node) {
+        node->score += score;
+        node = node->parent;
+        score = (1U << FIXED_SCALE_BITS) - score;
+    }
+}
+
+static struct node *most_visited_child(struct node *node)
+{
+    struct node *best_node = node;
+    int most_visits = -1;
+    for (struct node *child = node->children; child; child = child->sibling) {
+        if (child->n_visits > most_visits) {
+            most_visits = child->n_visits;
+            best_node = child;
+        }
+    }
+    return best_node;
+}
+
+static bool is_line_start(int n_lines, int move)
+{
+    for (int i = 0; i < n_lines; i++)
+        if (analysis.lines[i].moves[0] == move)
+            return true;
+    return false;
+}
+
+/* The lines of the most visited root children, each one following the most
+ * visited child down the tree, scored by the share of the root visits.
+ */
+static void analysis_build(struct node *root, int iterations)
+{
+    int n_lines = analysis_n_lines();
+
+    analysis.player = root->player;
+    analysis.depth = iterations;
+    analysis.n_lines = 0;
+    while (analysis.n_lines < n_lines) {
+        struct node *best = NULL;
+        for (struct node *child = root->children; child;
+             child = child->sibling)
+            if (!is_line_start(analysis.n_lines, child->move) &&
+                (!best || child->n_visits > best->n_visits))
+                best = child;
+        if (!best || !best->n_visits)
+            break;
+
+        struct pv_line *line = &analysis.lines[analysis.n_lines++];
+        struct node *node = best;
+        line->score = best->n_visits * 1000 / root->n_visits;
+        line->length = 0;
+        while (line->length < MAX_PV_LENGTH) {
+            line->moves[line->length++] = node->move;
+            struct node *next = most_visited_child(node);
+            if (next == node || !next->n_visits)
+                break;
+            node = next;
+        }
+    }
+}
+
+/* Snapshot for the search in progress and its depth, set by mcts_prepare().
+ * The depth bounds the recursion of dump_node().
+ */
+static struct tree_dump *pending_dump;
+static unsigned int dump_depth;
+
+/* Writes node and its subtree in preorder while the snapshot has room, with
+ * table holding the board at node.
+ */
+static void dump_node(struct tree_dump *dump,
+                      unsigned int capacity,
+                      const struct node *node,
+                      char *table,
+                      unsigned int depth)
+{
+    struct tree_dump_node *out = &dump->nodes[dump->header.n_nodes++];
+
+    out->move = node->parent ? node->move : TREE_DUMP_NO_MOVE;
+    out->result = check_win(table);
+    out->n_children = 0;
+    out->n_visits = node->n_visits;
+    out->score = node->score;
+    out->prior = node->prior;
+    if (!depth || out->result != ' ')
+        return;
+    for (struct node *child = node->children; child; child = child->sibling) {
+        if (child->n_visits < tree_dump_visits)
+            continue;
+        if (dump->header.n_nodes == capacity)
+            break;
+        table[child->move] = node->player;
+        dump_node(dump, capacity, child, table, depth - 1);
+        table[child->move] = ' ';
+        out->n_children++;
+    }
+}
+
+/* Fills the snapshot of mcts_prepare() with the tree of the move just
+ * searched, for mcts_finish() to publish. The snapshot is taken by the search
+ * itself, a reader only ever waits on a pointer swap.
+ */
+static void tree_snapshot(const struct node *root, const char *table)
+{
+    struct tree_dump *dump = pending_dump;
+    char temp_table[MAX_GRIDS];
+
+    if (!dump)
+        return;
+    dump->header = (struct tree_dump_header){
+        .magic = TREE_DUMP_MAGIC,
+        .version = TREE_DUMP_VERSION,
+        .board_size = game->board_size,
+        .player = root->player,
+        .scale_bits = FIXED_SCALE_BITS,
+    };
+    memcpy(temp_table, table, game->n_grids);
+    dump_node(dump, TREE_DUMP_MAX_NODES, root, temp_table, dump_depth);
+}
+
+/* Shares the move just searched with the next games when the search agreed
+ * on it, which analysis_build() measured.
+ */
+static void cache_result(const char *table, char player, int iterations)
+{
+    if (!analysis.n_lines || analysis.lines[0].score < cache_min_share)
+        return;
+    poscache_store(table, player,
+                   &(struct poscache_result){
+                       .move = analysis.lines[0].moves[0],
+                       .value = analysis.lines[0].score,
+                       .effort = iterations,
+                       .engine = POSCACHE_MCTS,
+                   });
+}
+
+/* AlphaZero-style search: every PUCT_BATCH descents are made in a row under
+ * virtual loss, and the leaves they reach are evaluated as one network batch,
+ * which expands them with the policy priors and backs up the value.
+ */
+static int mcts_puct(char *table, char player)
+{
+    size_t mark = arena_mark(&game_arena);
+    struct {
+        char tables[PUCT_BATCH][N_GRIDS];
+        char players[PUCT_BATCH];
+        struct node *leaves[PUCT_BATCH];
+        struct mlp_eval evals[PUCT_BATCH];
+    } *batch = node_alloc(sizeof(*batch));
+    struct node *root = new_node(-1, player, NULL);
+    if (!batch || !root) {
+        arena_release(&game_arena, mark);
+        return -1;
+    }
+
+    mcts_obj.nr_active_nodes = 1;
+    for (int i = 0; i < PUCT_ITERATIONS; i += PUCT_BATCH) {
+        int n_leaves = 0;
+        for (int b = 0; b < PUCT_BATCH; b++) {
+            struct node *node = root;
+            char *temp_table = batch->tables[n_leaves];
+            memcpy(temp_table, table, N_GRIDS);
+            node->n_visits++;
+            while (node->n_children) {
+                node = select_puct(node);
+                temp_table[node->move] = node->player ^ 'O' ^ 'X';
+                node->n_visits++;
+            }
+            char win = check_win(temp_table);
+            if (win != ' ') {
+                backpropagate_puct(
+                    node, calculate_win_value(win, node->player ^ 'O' ^ 'X'));
+                continue;
+            }
+            batch->players[n_leaves] = node->player;
+            batch->leaves[n_leaves++] = node;
+        }
+        if (!n_leaves)
+            continue;
+
+        mlp_evaluate_batch((const char(*)[N_GRIDS]) batch->tables,
+                           batch->players, batch->evals, n_leaves);
+        for (int b = 0; b < n_leaves; b++) {
+            struct node *node = batch->leaves[b];
+            /* The same leaf may be reached twice within one batch */
+            if (!node->n_children) {
+                movegen_init(&search_mg, batch->tables[b]);
+                expand(node, &search_mg);
+                while (node->n_created < node->n_children) {
+                    struct node *child = add_child(node);
+                    /* With the arena full, the leaf keeps what it got */
+                    if (!child) {
+                        node->n_children = node->n_created;
+                        break;
+                    }
+                    child->prior = batch->evals[b].prior[child->move];
+                }
+            }
+            backpropagate_puct(
+                node, (1U << FIXED_SCALE_BITS) - batch->evals[b].value);
+        }
+    }
+    int best_move = most_visited_child(root)->move;
+    analysis_build(root, PUCT_ITERATIONS);
+    cache_result(table, player, PUCT_ITERATIONS);
+    tree_snapshot(root, table);
+    arena_release(&game_arena, mark);
+    return best_move;
+}
+
 int mcts(char *table, char player)
 {
     char win;
+
+    int book_move = book_probe(table, player);
+    if (book_move != -1) {
+        analysis_single(&analysis, player, book_move, 1000);
+        return book_move;
+    }
+    struct poscache_result cached;
+    struct poscache_key root_key;
+    poscache_key_init(&root_key, table, player);
+    if (poscache_probe_key(&root_key, table, &cached) &&
+        (cached.proven || (cached.engine == POSCACHE_MCTS &&
+                           cached.value >= cache_min_share))) {
+        /* A proven move is as sure as one given all the visits */
+        analysis_single(&analysis, player, cached.move,
+                        cached.engine == POSCACHE_MCTS ? cached.value : 1000);
+        return cached.move;
+    }
+    int tss_move = tss_probe(table, player);
+    if (tss_move != -1) {
+        analysis_single(&analysis, player, tss_move, 1000);
+        poscache_store(table, player,
+                       &(struct poscache_result){.move = tss_move,
+                                                 .proven = true,
+                                                 .engine = POSCACHE_TSS});
+        return tss_move;
+    }
+    if (mcts_mode == MCTS_MODE_PUCT && mlp_ready())
+        return mcts_puct(table, player);
+
+    if (check_win(table) != ' ') {
+        analysis_single(&analysis, player, -1, 0);
+        return -1;
+    }
+
+    char temp_table[MAX_GRIDS];
+    memcpy(temp_table, table, game->n_grids);
+    movegen_init(&search_mg, table);
+    size_t mark = arena_mark(&game_arena);
     struct node *root = new_node(-1, player, NULL);
+    if (!root)
+        return -1;
     mcts_obj.nr_active_nodes = 1;
-    for (int i = 0; i < ITERATIONS; i++) {
+    int i;
+    for (i = 0; i < ITERATIONS; i++) {
         struct node *node = root;
-        char temp_table[N_GRIDS];
-        memcpy(temp_table, table, N_GRIDS);
+        struct poscache_key key = root_key;
         while (1) {
-            if ((win = check_win(temp_table)) != ' ') {
+            /* The root was checked once and for all above */
+            if (node != root &&
+                (win = check_win_after(temp_table, &search_mg, node->move)) !=
+                    ' ') {
                 fixed_point_t score =
                     calculate_win_value(win, node->player ^ 'O' ^ 'X');
                 backpropagate(node, score);
                 break;
             }
             if (node->n_visits == 0) {
-                fixed_point_t score = simulate(temp_table, node->player);
+                fixed_point_t score =
+                    evaluate_leaf(temp_table, node->player, &search_mg, &key);
                 backpropagate(node, score);
                 break;
             }
-            if (node->children[0] == NULL)
-                mcts_obj.nr_active_nodes += expand(node, temp_table);
+            if (!node->n_children)
+                expand(node, &search_mg);
             node = select_move(node);
             if (!node)
-                return -1;
+                goto out;
             temp_table[node->move] = node->player ^ 'O' ^ 'X';
+            movegen_play(&search_mg, node->move, temp_table[node->move]);
+            poscache_key_play(&key, node->move, temp_table[node->move]);
         }
-    }
-    struct node *best_node = root;
-    int most_visits = -1;
-    for (int i = 0; i < N_GRIDS; i++) {
-        if (root->children[i] && root->children[i]->n_visits > most_visits) {
-            most_visits = root->children[i]->n_visits;
-            best_node = root->children[i];
+        for (; node != root; node = node->parent) {
+            movegen_undo(&search_mg, node->move, temp_table[node->move]);
+            temp_table[node->move] = ' ';
         }
     }
-    int best_move = best_node->move;
-    free_node(root);
+out:
+    if (i < ITERATIONS)
+        pr_warn("kmldrv: MCTS search cut short after %d iterations\n", i);
+    int best_move = most_visited_child(root)->move;
+    analysis_build(root, i);
+    cache_result(table, player, i);
+    tree_snapshot(root, table);
+    arena_release(&game_arena, mark);
     return best_move;
 }
 
+void mcts_prepare(void)
+{
+    dump_depth = min_t(unsigned int, READ_ONCE(tree_dump_depth),
+                       MAX_PV_LENGTH);
+    if (dump_depth)
+        pending_dump = tree_dump_alloc(TREE_DUMP_MAX_NODES);
+}
+
+void mcts_finish(void)
+{
+    struct tree_dump *dump = pending_dump;
+
+    if (!dump)
+        return;
+    pending_dump = NULL;
+    /* Moves from the book or the cache leave no tree */
+    if (dump->header.n_nodes)
+        tree_dump_publish(dump);
+    else
+        tree_dump_put(dump);
+}
+
+const struct analysis *mcts_analysis(void)
+{
+    return &analysis;
+}
+
 unsigned long count_active_nodes(void)
 {
     return mcts_obj.nr_active_nodes;
 }
 
+/* Selections of a node of n children timed by mcts_benchmark(), about the
+ * same work whatever n.
+ */
+#define SELECT_BENCH_SLOTS (1 << 25)
+
+/* Times select_move() on a fully expanded node of n_children children with
+ * random statistics, up to the 225 of the root of a 15x15 search.
+ */
+static void select_benchmark(int n_children)
+{
+    size_t mark = arena_mark(&game_arena);
+    struct node *root = new_node(-1, 'O', NULL);
+    int rounds = SELECT_BENCH_SLOTS / n_children, total = 0;
+    ktime_t tv_start, tv_end;
+
+    if (!root || !(root->moves = node_alloc(n_children)))
+        goto out;
+    root->n_children = n_children;
+    for (int i = 0; i < n_children; i++)
+        root->moves[i] = i;
+    for (int i = 0; i < n_children; i++) {
+        struct node *child = add_child(root);
+        if (!child)
+            goto out;
+        child->n_visits = 1 + xoro_next(&mcts_obj.xoro_obj) % 3000;
+        child->score = xoro_next(&mcts_obj.xoro_obj) %
+                       (child->n_visits << FIXED_SCALE_BITS);
+        total += child->n_visits;
+    }
+
+    tv_start = ktime_get();
+    for (int i = 0; i < rounds; i++) {
+        /* A parent count of its own for every selection */
+        root->n_visits = total + (i & 1023);
+        struct node *best = select_move(root);
+        OPTIMIZER_HIDE_VAR(best);
+    }
+    tv_end = ktime_get();
+
+    u64 nsecs = ktime_to_ns(ktime_sub(tv_end, tv_start));
+    pr_info("kmldrv: [MCTS] %d children: %llu selections/sec\n", n_children,
+            (unsigned long long) div64_u64((u64) rounds * NSEC_PER_SEC,
+                                           nsecs | 1));
+out:
+    arena_release(&game_arena, mark);
+}
+
+void mcts_benchmark(void)
+{
+    static const int n_children[] = {16, 64, 225};
+
+    if (!select_bench)
+        return;
+    for (int i = 0; i < ARRAY_SIZE(n_children); i++)
+        select_benchmark(n_children[i]);
+    mcts_obj.nr_active_nodes = 0;
+}
+
 void mcts_init(void)
 {
     xoro_init(&(mcts_obj.xoro_obj));
     mcts_obj.nr_active_nodes = 0;
+    uct_init();
 }
\ No newline at end of file
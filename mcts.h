@@ -1,15 +1,48 @@
 #pragma once
 
+#include "mlp.h"
 #include "xoroshiro.h"
 
 #define ITERATIONS 100000
 #define EXPLORATION_FACTOR fixed_sqrt(1U << (FIXED_SCALE_BITS + 1))
 
+/* PUCT with network priors needs far fewer iterations than rollout UCT */
+#define PUCT_ITERATIONS 2048
+#define PUCT_BATCH MLP_BATCH_MAX
+#define PUCT_C (3U << (FIXED_SCALE_BITS - 1))
+
+enum {
+    MCTS_MODE_UCT,
+    MCTS_MODE_PUCT,
+};
+
+enum {
+    LEAF_EVAL_ROLLOUT,
+    LEAF_EVAL_NETWORK,
+    LEAF_EVAL_MIXED,
+};
+
 struct mcts_info {
     struct state_array xoro_obj;
     int nr_active_nodes;
 };
 
+struct analysis;
+
 unsigned long count_active_nodes(void);
 int mcts(char *table, char player);
-void mcts_init(void);
\ No newline at end of file
+void mcts_init(void);
+/* Patches the playouts for playout_wyhash, before a search in process
+ * context, as game_ops_select().
+ */
+void playout_rng_select(void);
+/* Called before each mcts() in process context, with the producer lock held
+ * and preemption enabled, to allocate what the search fills.
+ */
+void mcts_prepare(void);
+/* Called after each mcts() with preemption enabled, to publish its tree */
+void mcts_finish(void);
+/* Logs the UCT selections per second with the module parameter select_bench */
+void mcts_benchmark(void);
+/* Lines found by the last mcts(), valid until the next one */
+const struct analysis *mcts_analysis(void);
\ No newline at end of file
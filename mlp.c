@@ -0,0 +1,273 @@
+#include <linux/firmware.h>
+#include <linux/ktime.h>
+#include <linux/math64.h>
+#include <linux/module.h>
+#include <linux/slab.h>
+#include <linux/string.h>
+#include <linux/version.h>
+#if LINUX_VERSION_CODE >= KERNEL_VERSION(6, 12, 0)
+#include <linux/unaligned.h>
+#else
+#include <asm/unaligned.h>
+#endif
+
+#include "mlp.h"
+
+MODULE_FIRMWARE(MLP_FIRMWARE);
+
+#define MLP_BENCH_ROUNDS (1 << 14)
+
+struct mlp_weights {
+    s16 w1[MLP_INPUTS][MLP_HIDDEN];
+    s16 b1[MLP_HIDDEN];
+    s8 wp[N_GRIDS][MLP_HIDDEN];
+    s32 bp[N_GRIDS];
+    s8 wv[MLP_HIDDEN];
+    s32 bv;
+    u8 acc_shift;
+    u8 out_shift;
+};
+
+static struct mlp_weights *weights;
+
+/* e^(-k/8) for k in [0, 64], with 16 fractional bits */
+static const u32 exp_neg_table[65] = {
+    65536, 57835, 51039, 45042, 39750, 35079, 30957, 27319, 24109, 21276, 18776,
+    16570, 14623, 12905, 11388, 10050, 8869,  7827,  6907,  6096,  5380,  4747,
+    4190,  3697,  3263,  2879,  2541,  2243,  1979,  1746,  1541,  1360,  1200,
+    1059,  935,   825,   728,   642,   567,   500,   442,   390,   344,   303,
+    268,   236,   209,   184,   162,   143,   127,   112,   99,    87,    77,
+    68,    60,    53,    47,    41,    36,    32,    28,    25,    22,
+};
+
+/* e^(-x) for a non-negative fixed-point x, with 16 fractional bits */
+static u32 exp_neg(u32 x)
+{
+    u32 idx = x >> (FIXED_SCALE_BITS - 3);
+    u32 frac = x & ((1U << (FIXED_SCALE_BITS - 3)) - 1);
+
+    if (idx >= 64)
+        return 0;
+    u32 step = exp_neg_table[idx] - exp_neg_table[idx + 1];
+    return exp_neg_table[idx] - ((step * frac) >> (FIXED_SCALE_BITS - 3));
+}
+
+static fixed_point_t sigmoid(s32 x)
+{
+    if (x < 0)
+        return (1U << FIXED_SCALE_BITS) - sigmoid(-x);
+    return (fixed_point_t) div_u64(1ULL << (FIXED_SCALE_BITS + 16),
+                                   (1U << 16) + exp_neg(x));
+}
+
+/* Plain int8 dot product, written so that the compiler can vectorize it
+ * wherever SIMD is usable.
+ */
+static inline s32 mlp_dot(const s8 *a, const s8 *b)
+{
+    s32 sum = 0;
+    for (int h = 0; h < MLP_HIDDEN; h++)
+        sum += a[h] * b[h];
+    return sum;
+}
+
+/* Inputs are binary, so the first layer is a sum of the weight rows of the
+ * occupied grids rather than a full matrix product.
+ */
+static void mlp_hidden(const struct mlp_weights *w,
+                       const char *table,
+                       char player,
+                       s8 *act)
+{
+    /* Up to N_GRIDS rows plus the bias overflow an s16 */
+    s32 acc[MLP_HIDDEN];
+
+    for (int h = 0; h < MLP_HIDDEN; h++)
+        acc[h] = w->b1[h];
+    for (int i = 0; i < N_GRIDS; i++) {
+        if (table[i] == ' ')
+            continue;
+        const s16 *row = w->w1[(i << 1) | (table[i] != player)];
+        for (int h = 0; h < MLP_HIDDEN; h++)
+            acc[h] += row[h];
+    }
+    for (int h = 0; h < MLP_HIDDEN; h++)
+        act[h] = clamp_t(s32, acc[h] >> w->acc_shift, 0, 127);
+}
+
+static fixed_point_t mlp_value_head(const struct mlp_weights *w, const s8 *act)
+{
+    return sigmoid((w->bv + mlp_dot(w->wv, act)) >> w->out_shift);
+}
+
+fixed_point_t mlp_value(const char *table, char player)
+{
+    s8 act[MLP_HIDDEN];
+
+    mlp_hidden(weights, table, player, act);
+    return mlp_value_head(weights, act);
+}
+
+/* The hidden layer is computed for the whole batch first, so that every
+ * weight row of the heads is loaded once and reused across the batch.
+ */
+void mlp_evaluate_batch(const char (*tables)[N_GRIDS],
+                        const char *players,
+                        struct mlp_eval *out,
+                        int n)
+{
+    const struct mlp_weights *w = weights;
+    s8 act[MLP_BATCH_MAX][MLP_HIDDEN];
+    s32 logit[MLP_BATCH_MAX][N_GRIDS];
+    s32 best[MLP_BATCH_MAX];
+
+    for (int b = 0; b < n; b++) {
+        mlp_hidden(w, tables[b], players[b], act[b]);
+        out[b].value = mlp_value_head(w, act[b]);
+        best[b] = S32_MIN;
+    }
+
+    for (int i = 0; i < N_GRIDS; i++) {
+        for (int b = 0; b < n; b++) {
+            if (tables[b][i] != ' ')
+                continue;
+            logit[b][i] = w->bp[i] + mlp_dot(w->wp[i], act[b]);
+            logit[b][i] >>= w->out_shift;
+            if (logit[b][i] > best[b])
+                best[b] = logit[b][i];
+        }
+    }
+
+    /* Softmax over the empty grids, shifted by the largest logit */
+    for (int b = 0; b < n; b++) {
+        u32 sum = 0;
+        for (int i = 0; i < N_GRIDS; i++) {
+            out[b].prior[i] = 0;
+            if (tables[b][i] != ' ')
+                continue;
+            logit[b][i] = exp_neg(best[b] - logit[b][i]);
+            sum += logit[b][i];
+        }
+        for (int i = 0; i < N_GRIDS; i++) {
+            if (tables[b][i] == ' ')
+                out[b].prior[i] =
+                    ((u32) logit[b][i] << FIXED_SCALE_BITS) / sum;
+        }
+    }
+}
+
+void mlp_evaluate(const char *table, char player, struct mlp_eval *out)
+{
+    mlp_evaluate_batch((const char(*)[N_GRIDS]) table, &player, out, 1);
+}
+
+int mlp_score(const char *table, char player)
+{
+    int value = mlp_value(table, player);
+
+    value -= 1 << (FIXED_SCALE_BITS - 1);
+    return value * MLP_SCORE_SCALE >> (FIXED_SCALE_BITS - 1);
+}
+
+/* The network only knows the board of the default variant */
+bool mlp_ready(void)
+{
+    return weights && game->board_size == BOARD_SIZE && game->goal == GOAL;
+}
+
+static int mlp_parse(const u8 *data, size_t size, struct mlp_weights *w)
+{
+    const struct mlp_header *hdr = (const struct mlp_header *) data;
+    size_t expected = sizeof(*hdr) + sizeof(w->b1) + sizeof(w->w1) +
+                      sizeof(w->bv) + sizeof(w->wv) + sizeof(w->bp) +
+                      sizeof(w->wp);
+
+    if (size != expected || get_unaligned_le32(&hdr->magic) != MLP_MAGIC ||
+        get_unaligned_le16(&hdr->version) != MLP_VERSION ||
+        hdr->board_size != BOARD_SIZE || hdr->hidden != MLP_HIDDEN ||
+        hdr->acc_shift > 15 || hdr->out_shift > 31)
+        return -EINVAL;
+
+    w->acc_shift = hdr->acc_shift;
+    w->out_shift = hdr->out_shift;
+    data += sizeof(*hdr);
+
+    for (int h = 0; h < MLP_HIDDEN; h++, data += 2)
+        w->b1[h] = get_unaligned_le16(data);
+    for (int i = 0; i < MLP_INPUTS; i++)
+        for (int h = 0; h < MLP_HIDDEN; h++, data += 2)
+            w->w1[i][h] = get_unaligned_le16(data);
+    w->bv = get_unaligned_le32(data);
+    data += 4;
+    memcpy(w->wv, data, sizeof(w->wv));
+    data += sizeof(w->wv);
+    for (int i = 0; i < N_GRIDS; i++, data += 4)
+        w->bp[i] = get_unaligned_le32(data);
+    memcpy(w->wp, data, sizeof(w->wp));
+    return 0;
+}
+
+int mlp_load(struct device *dev)
+{
+    const struct firmware *fw;
+    int ret = request_firmware_direct(&fw, MLP_FIRMWARE, dev);
+    if (ret) {
+        pr_info("kmldrv: %s not found, network evaluator disabled\n",
+                MLP_FIRMWARE);
+        return ret;
+    }
+
+    struct mlp_weights *w = kzalloc(sizeof(*w), GFP_KERNEL);
+    if (!w) {
+        ret = -ENOMEM;
+        goto out;
+    }
+    ret = mlp_parse(fw->data, fw->size, w);
+    if (ret) {
+        pr_err("kmldrv: malformed %s (%zu bytes)\n", MLP_FIRMWARE, fw->size);
+        kfree(w);
+        goto out;
+    }
+    weights = w;
+    pr_info("kmldrv: network evaluator loaded from %s\n", MLP_FIRMWARE);
+out:
+    release_firmware(fw);
+    return ret;
+}
+
+void mlp_unload(void)
+{
+    kfree(weights);
+    weights = NULL;
+}
+
+void mlp_benchmark(void)
+{
+    struct mlp_eval *out = kmalloc(sizeof(*out), GFP_KERNEL);
+    char table[N_GRIDS];
+    ktime_t tv_start, tv_end;
+
+    if (!out || !weights) {
+        kfree(out);
+        return;
+    }
+
+    memset(table, ' ', N_GRIDS);
+    tv_start = ktime_get();
+    for (int i = 0; i < MLP_BENCH_ROUNDS; i++) {
+        /* Cycle through positions with a varying number of stones */
+        int grid = i % N_GRIDS;
+        if (!grid)
+            memset(table, ' ', N_GRIDS);
+        table[grid] = (i & 1) ? 'X' : 'O';
+        mlp_evaluate(table, 'O', out);
+    }
+    tv_end = ktime_get();
+
+    u64 nsecs = ktime_to_ns(ktime_sub(tv_end, tv_start));
+    pr_info("kmldrv: [MLP] %d evaluations in %llu usec, %llu evaluations/sec\n",
+            MLP_BENCH_ROUNDS, (unsigned long long) nsecs >> 10,
+            (unsigned long long) div64_u64(
+                (u64) MLP_BENCH_ROUNDS * NSEC_PER_SEC, nsecs | 1));
+    kfree(out);
+}
@@ -0,0 +1,78 @@
+#pragma once
+
+#ifdef __KERNEL__
+#include <linux/types.h>
+#else
+#include <stdint.h>
+typedef uint8_t u8;
+typedef uint16_t __le16;
+typedef uint32_t __le32;
+#define __packed __attribute__((packed))
+#endif
+
+#include "game.h"
+
+/* Fixed-point multi-layer perceptron used as a leaf evaluator.
+ *
+ * The input is the board seen from the player to move: every grid owns two
+ * binary inputs, (grid << 1) for a stone of the player to move and
+ * (grid << 1) + 1 for an opponent stone. The hidden layer accumulates int16
+ * weights, is clipped to [0, 127] and feeds two int8 heads, a value head and
+ * a policy head with one logit per grid.
+ *
+ * The weights are loaded from the firmware blob MLP_FIRMWARE, laid out as the
+ * packed little-endian sequence
+ *
+ *   struct mlp_header header;
+ *   s16 b1[MLP_HIDDEN];
+ *   s16 w1[MLP_INPUTS][MLP_HIDDEN];
+ *   s32 bv;
+ *   s8 wv[MLP_HIDDEN];
+ *   s32 bp[N_GRIDS];
+ *   s8 wp[N_GRIDS][MLP_HIDDEN];
+ *
+ * Hidden activations are (acc >> acc_shift), and head outputs are
+ * ((bias + dot) >> out_shift) logits with FIXED_SCALE_BITS fractional bits.
+ * kmldrv-tune -m trains the network and writes the blob.
+ */
+#define MLP_FIRMWARE "kmldrv-mlp.bin"
+#define MLP_MAGIC 0x4e4c4d4bU /* "KMLN" */
+#define MLP_VERSION 1
+#define MLP_HIDDEN 32
+#define MLP_INPUTS (N_GRIDS << 1)
+#define MLP_BATCH_MAX 8
+
+/* Range of the score handed to negamax, kept below a completed line */
+#define MLP_SCORE_SCALE 64
+
+struct mlp_header {
+    __le32 magic;
+    __le16 version;
+    u8 board_size;
+    u8 hidden;
+    u8 acc_shift;
+    u8 out_shift;
+    __le16 reserved;
+} __packed;
+
+/* Both values are from the perspective of the player to move: value is the
+ * winning probability and prior[] the move distribution over the empty grids.
+ */
+struct mlp_eval {
+    fixed_point_t value;
+    fixed_point_t prior[N_GRIDS];
+};
+
+struct device;
+
+int mlp_load(struct device *dev);
+void mlp_unload(void);
+bool mlp_ready(void);
+fixed_point_t mlp_value(const char *table, char player);
+void mlp_evaluate(const char *table, char player, struct mlp_eval *out);
+void mlp_evaluate_batch(const char (*tables)[N_GRIDS],
+                        const char *players,
+                        struct mlp_eval *out,
+                        int n);
+int mlp_score(const char *table, char player);
+void mlp_benchmark(void);
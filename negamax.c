@@ -1,99 +1,635 @@
-#include <linux/slab.h>
-#include <linux/sort.h>
+#include <linux/kernel.h>
+#include <linux/ktime.h>
+#include <linux/limits.h>
+#include <linux/moduleparam.h>
+#include <linux/printk.h>
 #include <linux/string.h>
 
+#include "analysis.h"
+#include "book.h"
 #include "game.h"
+#include "mlp.h"
 #include "negamax.h"
+#include "poscache.h"
+#include "tlbstat.h"
+#include "tss.h"
 #include "util.h"
 #include "zobrist.h"
 
-#define MAX_SEARCH_DEPTH 6
+#define MAX_SEARCH_DEPTH 32
+#define N_KILLERS 2
+#define SCORE_INF 100000
 
-static int history_score_sum[N_GRIDS];
-static int history_count[N_GRIDS];
+/* A finished game scores SCORE_WIN less the plies to reach it, so that the
+ * quickest win and the slowest loss are preferred. Evaluations stay below
+ * SCORE_DECIDED, which only a result of the game reaches.
+ */
+#define SCORE_WIN 50000
+#define SCORE_DECIDED (SCORE_WIN - MAX_SEARCH_DEPTH)
+
+/* Nodes searched between two reads of the clock */
+#define CLOCK_CHECK_NODES 1024
+
+/* Half width of the window around the score of the previous iteration */
+#define ASPIRATION_WINDOW 50
+
+/* Mean score of every move searched so far, kept as history_score so that
+ * ordering does not divide.
+ */
+static int history_score_sum[MAX_GRIDS];
+static int history_count[MAX_GRIDS];
+static int history_score[MAX_GRIDS];
+
+/* Quiet moves that caused a cutoff, per ply, the most recent first */
+static int killers[MAX_SEARCH_DEPTH][N_KILLERS];
+
+/* Moves of every ply being searched, kept off the kernel stack */
+static int ply_moves[MAX_SEARCH_DEPTH][MAX_GRIDS];
+static int ply_keys[MAX_SEARCH_DEPTH][MAX_GRIDS];
+
+/* Triangular PV table: pv[ply] holds the best line found from ply on, in
+ * pv[ply][ply .. pv_length[ply]).
+ */
+static int pv[MAX_SEARCH_DEPTH + 1][MAX_SEARCH_DEPTH + 1];
+static int pv_length[MAX_SEARCH_DEPTH + 1];
+
+/* Line of the last root search that did not fail low */
+static struct pv_line root_pv;
+
+/* Root moves left out of the search for the next best lines of multi_pv */
+static int excluded[MAX_MULTI_PV];
+static int n_excluded;
+
+static struct analysis analysis;
+
+/* Rank of each grid by its distance to the center, the center highest */
+static int center_rank[MAX_GRIDS];
 
 static u64 hash_value;
+static struct movegen movegen;
+static int root_depth;
+
+/* An iteration still running at the deadline is aborted, and the move of
+ * the last completed one is played. The first iteration always completes.
+ */
+static u64 deadline;
+static bool aborted;
+static unsigned int clock_countdown;
+
+static struct {
+    unsigned long nodes;
+    unsigned long cutoffs;
+    unsigned long first_cutoffs;
+    unsigned long searches; /* root searches, re-searches included */
+} stats;
+
+/* Probes of the transposition table during a move, and how many hit an
+ * entry stored while searching an earlier move.
+ */
+static struct {
+    unsigned long probes;
+    unsigned long hits;
+    unsigned long reused;
+} tt_stats;
+
+static bool network_eval;
+module_param(network_eval, bool, 0644);
+MODULE_PARM_DESC(network_eval, "Evaluate negamax leaves with the network");
+
+static bool search_stats;
+module_param(search_stats, bool, 0644);
+MODULE_PARM_DESC(search_stats, "Log node counts and cutoff rates of negamax");
+
+static unsigned int cache_min_depth = 8;
+module_param(cache_min_depth, uint, 0644);
+MODULE_PARM_DESC(cache_min_depth,
+                 "Shallowest cached negamax result played without searching");
+
+static bool mtdf;
+module_param(mtdf, bool, 0644);
+MODULE_PARM_DESC(mtdf, "Drive negamax by MTD(f) instead of aspiration windows");
+
+static void center_rank_init(void)
+{
+    int size = game->board_size;
+
+    for (int i = 0; i < size; i++)
+        for (int j = 0; j < size; j++)
+            center_rank[i * size + j] =
+                -(abs(2 * i - size + 1) + abs(2 * j - size + 1));
+}
+
+/* Ordering keys of the moves: the TT move, then the killers, then the
+ * history score, with the center rank breaking ties.
+ */
+static void order_init(const int *moves,
+                       int n_moves,
+                       int tt_move,
+                       int ply,
+                       int *keys)
+{
+    for (int i = 0; i < n_moves; i++) {
+        int move = moves[i];
+        if (move == tt_move)
+            keys[i] = INT_MAX;
+        else if (move == killers[ply][0])
+            keys[i] = INT_MAX - 1;
+        else if (move == killers[ply][1])
+            keys[i] = INT_MAX - 2;
+        else
+            keys[i] = history_score[move];
+    }
+}
+
+/* Moves the best of moves[i..n_moves) to moves[i], one step of a selection
+ * sort so that a cutoff leaves the remaining moves unsorted.
+ */
+static void order_pick(int *moves, int *keys, int i, int n_moves)
+{
+    int best = i;
+
+    for (int j = i + 1; j < n_moves; j++)
+        if (keys[j] > keys[best] ||
+            (keys[j] == keys[best] &&
+             center_rank[moves[j]] > center_rank[moves[best]]))
+            best = j;
+    swap(moves[i], moves[best]);
+    swap(keys[i], keys[best]);
+}
+
+static void pv_update(int ply, int move)
+{
+    pv[ply][ply] = move;
+    for (int i = ply + 1; i < pv_length[ply + 1]; i++)
+        pv[ply][i] = pv[ply + 1][i];
+    pv_length[ply] = max(pv_length[ply + 1], ply + 1);
+}
 
-static int cmp_moves(const void *a, const void *b)
+static bool is_excluded(int move)
 {
-    int *_a = (int *) a, *_b = (int *) b;
-    int score_a = 0, score_b = 0;
+    for (int i = 0; i < n_excluded; i++)
+        if (excluded[i] == move)
+            return true;
+    return false;
+}
+
+/* Drops the excluded moves from the moves of the root */
+static int exclude_moves(int *moves, int n_moves)
+{
+    int n = 0;
 
-    if (history_count[*_a])
-        score_a = history_score_sum[*_a] / history_count[*_a];
-    if (history_count[*_b])
-        score_b = history_score_sum[*_b] / history_count[*_b];
-    return score_b - score_a;
+    for (int i = 0; i < n_moves; i++)
+        if (!is_excluded(moves[i]))
+            moves[n++] = moves[i];
+    return n;
 }
 
-static move_t negamax(char *table, int depth, char player, int alpha, int beta)
+static bool out_of_time(void)
 {
-    if (check_win(table) != ' ' || depth == 0) {
-        move_t result = {get_score(table, player), -1};
+    if (aborted)
+        return true;
+    if (--clock_countdown)
+        return false;
+    clock_countdown = CLOCK_CHECK_NODES;
+    aborted = root_depth > 1 && ktime_get_ns() > deadline;
+    return aborted;
+}
+
+/* Share of the interval between two moves that a move may take. The middle
+ * game gains the most from depth, while the opening is usually played from
+ * the book and the endgame is solved quickly, so both get half of it. A
+ * quarter is always left for the rest of the timer tick.
+ */
+static u64 move_budget_ns(unsigned int interval_ms, int n_stones)
+{
+    u64 budget = (u64) interval_ms * NSEC_PER_MSEC * 3 / 4;
+
+    if (n_stones < game->n_grids / 8 ||
+        game->n_grids - n_stones < game->n_grids / 4)
+        budget >>= 1;
+    return budget;
+}
+
+static void killer_add(int ply, int move)
+{
+    if (killers[ply][0] == move)
+        return;
+    killers[ply][1] = killers[ply][0];
+    killers[ply][0] = move;
+}
+
+static void history_add(int move, int score)
+{
+    history_count[move]++;
+    history_score_sum[move] += score;
+    history_score[move] = history_score_sum[move] / history_count[move];
+}
+
+/* Whether the search in progress scores its leaves with the network */
+static bool use_network;
+
+/* search_stats of the move in progress, read once by negamax_prepare() so
+ * that the counters are released if and only if they were started.
+ */
+static bool log_stats;
+static struct tlb_counter tlb;
+
+/* Finished games are scored by their result, so that a completed line
+ * outweighs any evaluation whatever the weights, and the player to move has
+ * lost one.
+ */
+static int evaluate(const char *table, char player, char win, int eval, int ply)
+{
+    if (win == 'D')
+        return 0;
+    if (win != ' ')
+        return -(SCORE_WIN - ply);
+    if (use_network)
+        eval = mlp_score(table, player);
+    return clamp(eval, -SCORE_DECIDED + 1, SCORE_DECIDED - 1);
+}
+
+/* eval is get_score(table, player), kept up to date move by move, and
+ * last_move is the grid of the last stone, -1 at the root.
+ */
+static move_t negamax(char *table,
+                      int depth,
+                      char player,
+                      int alpha,
+                      int beta,
+                      int eval,
+                      int last_move)
+{
+    int ply = root_depth - depth;
+    /* The root only cuts off on, and stores, the value of all its moves */
+    bool excluding = !ply && n_excluded;
+
+    pv_length[ply] = ply;
+    if (out_of_time())
+        return (move_t){.score = 0, .move = -1};
+    char win = check_win_after(table, &movegen, last_move);
+    if (win != ' ' || depth == 0) {
+        move_t result = {evaluate(table, player, win, eval, ply), -1};
         return result;
     }
     zobrist_entry_t *entry = zobrist_get(hash_value);
-    if (entry)
+    tt_stats.probes++;
+    if (entry) {
+        tt_stats.hits++;
+        tt_stats.reused += zobrist_reused(entry);
+    }
+    if (entry && !excluding && entry->depth >= depth &&
+        (entry->bound == ZOBRIST_EXACT ||
+         (entry->bound == ZOBRIST_LOWER && entry->score >= beta) ||
+         (entry->bound == ZOBRIST_UPPER && entry->score <= alpha)))
         return (move_t){.score = entry->score, .move = entry->move};
 
     int score;
     move_t best_move = {-10000, -1};
-    int *moves = available_moves(table);
-    int n_moves = 0;
-    while (n_moves < N_GRIDS && moves[n_moves] != -1)
-        ++n_moves;
-
-    sort(moves, n_moves, sizeof(int), cmp_moves, NULL);
+    int *moves = ply_moves[ply], *keys = ply_keys[ply];
+    int n_moves = movegen_moves(&movegen, moves);
+    int alpha_orig = alpha;
 
-    for (int i = 0; i < n_moves; i++) {
+    if (excluding)
+        n_moves = exclude_moves(moves, n_moves);
+    stats.nodes++;
+    order_init(moves, n_moves, entry ? entry->move : -1, ply, keys);
+    for (int i = 0; i < n_moves && !aborted; i++) {
+        order_pick(moves, keys, i, n_moves);
+        /* The pattern scores are antisymmetric, so the opponent's evaluation
+         * is the negation of ours.
+         */
+        int child_eval = -(eval + eval_move_delta(table, moves[i], player));
+        char opponent = player == 'X' ? 'O' : 'X';
         table[moves[i]] = player;
+        movegen_play(&movegen, moves[i], player);
         hash_value ^= zobrist_table[moves[i]][player == 'X'];
         if (!i)
-            score = -negamax(table, depth - 1, player == 'X' ? 'O' : 'X', -beta,
-                             -alpha)
+            score = -negamax(table, depth - 1, opponent, -beta, -alpha,
+                             child_eval, moves[i])
                          .score;
         else {
-            score = -negamax(table, depth - 1, player == 'X' ? 'O' : 'X',
-                             -alpha - 1, -alpha)
+            score = -negamax(table, depth - 1, opponent, -alpha - 1, -alpha,
+                             child_eval, moves[i])
                          .score;
             if (alpha < score && score < beta)
-                score = -negamax(table, depth - 1, player == 'X' ? 'O' : 'X',
-                                 -beta, -score)
+                score = -negamax(table, depth - 1, opponent, -beta, -score,
+                                 child_eval, moves[i])
                              .score;
         }
-        history_count[moves[i]]++;
-        history_score_sum[moves[i]] += score;
-        if (score > best_move.score) {
+        history_add(moves[i], score);
+        /* Even a lost position returns a move */
+        if (score > best_move.score || best_move.move == -1) {
             best_move.score = score;
             best_move.move = moves[i];
+            pv_update(ply, moves[i]);
         }
         table[moves[i]] = ' ';
+        movegen_undo(&movegen, moves[i], player);
         hash_value ^= zobrist_table[moves[i]][player == 'X'];
         if (score > alpha)
             alpha = score;
-        if (alpha >= beta)
+        if (alpha >= beta) {
+            stats.cutoffs++;
+            stats.first_cutoffs += !i;
+            if (keys[i] < INT_MAX)
+                killer_add(ply, moves[i]);
             break;
+        }
     }
 
-    kfree((char *) moves);
-    zobrist_put(hash_value, best_move.score, best_move.move);
+    if (aborted || excluding)
+        return best_move;
+    zobrist_put(hash_value, best_move.score, best_move.move, depth,
+                best_move.score <= alpha_orig ? ZOBRIST_UPPER
+                : best_move.score >= beta     ? ZOBRIST_LOWER
+                                              : ZOBRIST_EXACT);
     return best_move;
 }
 
+static move_t search_root(char *table,
+                          int depth,
+                          char player,
+                          int alpha,
+                          int beta,
+                          int eval)
+{
+    stats.searches++;
+    move_t result = negamax(table, depth, player, alpha, beta, eval, -1);
+
+    /* A root cut off by the TT has no line of its own */
+    if (aborted || result.move == -1 || result.score <= alpha)
+        return result;
+    if (!pv_length[0] || pv[0][0] != result.move) {
+        pv[0][0] = result.move;
+        pv_length[0] = 1;
+    }
+    root_pv.score = result.score;
+    root_pv.length = min(pv_length[0], MAX_PV_LENGTH);
+    for (int i = 0; i < root_pv.length; i++)
+        root_pv.moves[i] = pv[0][i];
+    return result;
+}
+
+/* Follows the TT moves past the end of line, where the search stopped on a
+ * TT cutoff or at its depth limit.
+ */
+static void pv_extend(const char *table, char player, struct pv_line *line)
+{
+    static char pv_table[MAX_GRIDS];
+    u64 hash = hash_value;
+
+    memcpy(pv_table, table, game->n_grids);
+    for (int i = 0; i < line->length; i++) {
+        pv_table[line->moves[i]] = player;
+        hash ^= zobrist_table[line->moves[i]][player == 'X'];
+        player ^= 'O' ^ 'X';
+    }
+    while (line->length < MAX_PV_LENGTH) {
+        zobrist_entry_t *entry = zobrist_get(hash);
+        if (!entry || entry->move < 0 || pv_table[entry->move] != ' ')
+            break;
+        line->moves[line->length++] = entry->move;
+        pv_table[entry->move] = player;
+        hash ^= zobrist_table[entry->move][player == 'X'];
+        player ^= 'O' ^ 'X';
+    }
+}
+
+/* Searches a window around guess, the score of the previous iteration, and
+ * opens the side it fails on.
+ */
+static move_t aspiration(char *table, int depth, char player, int guess,
+                         int eval)
+{
+    int alpha = max(guess - ASPIRATION_WINDOW, -SCORE_INF);
+    int beta = min(guess + ASPIRATION_WINDOW, SCORE_INF);
+
+    for (;;) {
+        move_t result = search_root(table, depth, player, alpha, beta, eval);
+        if (aborted)
+            return result;
+        if (result.score <= alpha && alpha > -SCORE_INF)
+            alpha = -SCORE_INF;
+        else if (result.score >= beta && beta < SCORE_INF)
+            beta = SCORE_INF;
+        else
+            return result;
+    }
+}
+
+/* MTD(f): null-window searches around guess until the lower and the upper
+ * bound of the value meet, the TT keeping the bounds of every pass. The
+ * move is the one of the last pass that failed high, whose score is a lower
+ * bound met by the value.
+ */
+static move_t mtd(char *table, int depth, char player, int guess, int eval)
+{
+    int lower = -SCORE_INF, upper = SCORE_INF;
+    move_t result, best = {.move = -1};
+
+    while (lower < upper) {
+        int beta = max(guess, lower + 1);
+        result = search_root(table, depth, player, beta - 1, beta, eval);
+        if (aborted)
+            return result;
+        guess = result.score;
+        if (guess < beta) {
+            upper = guess;
+        } else {
+            lower = guess;
+            best = result;
+        }
+    }
+    if (best.move == -1)
+        best.move = result.move;
+    best.score = guess;
+    return best;
+}
+
+/* The next best lines of multi_pv, each searched with a full window and
+ * the root moves of the lines before it left out. Returns false once the
+ * search runs out of time.
+ */
+static bool search_lines(char *table,
+                         int depth,
+                         char player,
+                         int eval,
+                         struct analysis *a)
+{
+    int n_lines = analysis_n_lines();
+
+    for (n_excluded = 1; n_excluded < n_lines; n_excluded++) {
+        excluded[n_excluded - 1] = a->lines[n_excluded - 1].moves[0];
+        root_pv.length = 0;
+        move_t line = search_root(table, depth, player, -SCORE_INF,
+                                  SCORE_INF, eval);
+        if (aborted || line.move == -1)
+            break;
+        pv_extend(table, player, &root_pv);
+        a->lines[a->n_lines++] = root_pv;
+    }
+    n_excluded = 0;
+    return !aborted;
+}
+
+const struct analysis *negamax_analysis(void)
+{
+    return &analysis;
+}
+
 void negamax_init(void)
 {
     zobrist_init();
-    hash_value = 0;
 }
 
-move_t negamax_predict(char *table, char player)
+void negamax_exit(void)
 {
+    zobrist_exit();
+}
+
+void negamax_new_game(void)
+{
+    zobrist_new_game();
+}
+
+void negamax_prepare(void)
+{
+    /* Scores stored under the other evaluator no longer hold */
+    bool network = READ_ONCE(network_eval) && mlp_ready();
+    if (network != use_network) {
+        use_network = network;
+        poscache_clear();
+        zobrist_new_game();
+    }
+    zobrist_prepare();
+    /* Creating perf counters allocates and takes mutexes */
+    log_stats = READ_ONCE(search_stats);
+    if (log_stats)
+        tlb_counter_start(&tlb);
+}
+
+void negamax_finish(void)
+{
+    struct tlb_counts counts;
+
+    if (!log_stats)
+        return;
+    tlb_counter_stop(&tlb, &counts);
+    pr_info("kmldrv: [negamax] %llu dTLB load misses, %llu remote node "
+            "loads\n",
+            counts.dtlb_misses, counts.remote_loads);
+    log_stats = false;
+}
+
+move_t negamax_predict(char *table, char player, unsigned int interval_ms)
+{
+    u64 start = ktime_get_ns();
+    int book_move = book_probe(table, player);
+    if (book_move != -1) {
+        analysis_single(&analysis, player, book_move, 0);
+        return (move_t){.score = 0, .move = book_move};
+    }
+    struct poscache_result cached;
+    if (poscache_probe(table, player, &cached) &&
+        (cached.proven || (cached.engine == POSCACHE_NEGAMAX &&
+                           cached.depth >= cache_min_depth))) {
+        int score = cached.engine == POSCACHE_TSS ? SCORE_INF : cached.value;
+        analysis_single(&analysis, player, cached.move, score);
+        return (move_t){.score = score, .move = cached.move};
+    }
+    int tss_move = tss_probe(table, player);
+    if (tss_move != -1) {
+        analysis_single(&analysis, player, tss_move, SCORE_INF);
+        poscache_store(table, player,
+                       &(struct poscache_result){.move = tss_move,
+                                                 .proven = true,
+                                                 .engine = POSCACHE_TSS});
+        return (move_t){.score = SCORE_INF, .move = tss_move};
+    }
+
+    zobrist_new_search();
+    hash_value = zobrist_key(table);
+    memset(&tt_stats, 0, sizeof(tt_stats));
     memset(history_score_sum, 0, sizeof(history_score_sum));
     memset(history_count, 0, sizeof(history_count));
-    move_t result;
-    for (int depth = 2; depth <= MAX_SEARCH_DEPTH; depth += 2) {
-        result = negamax(table, depth, player, -100000, 100000);
-        zobrist_clear();
+    memset(history_score, 0, sizeof(history_score));
+    memset(killers, -1, sizeof(killers));
+    center_rank_init();
+    move_t result = {.score = 0, .move = -1};
+    struct analysis iteration_analysis = {.player = player};
+    int eval = get_score(table, player);
+    movegen_init(&movegen, table);
+    deadline = start + move_budget_ns(interval_ms, movegen.n_stones);
+    aborted = false;
+    clock_countdown = CLOCK_CHECK_NODES;
+    /* Deeper than the number of empty grids, the search is exhaustive.
+     * Entries of the shallower iterations only order the deeper ones. With
+     * multi_pv, an iteration completes once all its lines are searched.
+     */
+    int max_depth = min(MAX_SEARCH_DEPTH, game->n_grids - movegen.n_stones);
+    unsigned long total_nodes = 0;
+    analysis.n_lines = 0;
+    for (int depth = 1; depth <= max_depth; depth++) {
+        move_t iteration;
+
+        memset(&stats, 0, sizeof(stats));
+        root_depth = depth;
+        root_pv.length = 0;
+        if (depth == 1)
+            iteration = search_root(table, depth, player, -SCORE_INF,
+                                    SCORE_INF, eval);
+        else if (mtdf)
+            iteration = mtd(table, depth, player, result.score, eval);
+        else
+            iteration = aspiration(table, depth, player, result.score, eval);
+        total_nodes += stats.nodes;
+        if (aborted || iteration.move == -1)
+            break;
+        if (!root_pv.length) {
+            root_pv.length = 1;
+            root_pv.moves[0] = iteration.move;
+        }
+        root_pv.score = iteration.score;
+        pv_extend(table, player, &root_pv);
+        iteration_analysis.depth = depth;
+        iteration_analysis.lines[0] = root_pv;
+        iteration_analysis.n_lines = 1;
+        if (!search_lines(table, depth, player, eval, &iteration_analysis))
+            break;
+        result = iteration;
+        analysis = iteration_analysis;
+        if (log_stats)
+            pr_info(
+                "kmldrv: [negamax] depth %d: %lu nodes in %lu searches, %lu "
+                "of %lu cutoffs on the first move\n",
+                depth, stats.nodes, stats.searches, stats.first_cutoffs,
+                stats.cutoffs);
+    }
+    if (log_stats && aborted)
+        pr_info("kmldrv: [negamax] depth %d aborted after %lu nodes\n",
+                root_depth, stats.nodes);
+    if (log_stats) {
+        pr_info("kmldrv: [negamax] %lu of %lu probes hit, %lu on entries "
+                "of earlier moves\n",
+                tt_stats.hits, tt_stats.probes, tt_stats.reused);
+        analysis_log("negamax", &analysis);
     }
+    /* Only a search of every move knows the result: to the end of the game,
+     * or to a finished game down every line, which its score tells.
+     */
+    bool proven = !game->candidate_radius &&
+                  (analysis.depth == game->n_grids - movegen.n_stones ||
+                   abs(result.score) >= SCORE_DECIDED);
+    poscache_store(
+        table, player,
+        &(struct poscache_result){
+            .move = result.move,
+            .value = result.score,
+            .depth = analysis.depth,
+            .effort = min(total_nodes, (unsigned long) UINT_MAX),
+            .proven = proven,
+            .engine = POSCACHE_NEGAMAX,
+        });
     return result;
 }
@@ -1,8 +1,27 @@
 #pragma once
 
+struct analysis;
+
 typedef struct {
     int score, move;
 } move_t;
 
 void negamax_init(void);
-move_t negamax_predict(char *table, char player);
+void negamax_exit(void);
+/* Called at the end of a game, before the first search of the next one */
+void negamax_new_game(void);
+/* Called before each negamax_predict() in process context, with the
+ * producer lock held and preemption enabled: does what may sleep or take
+ * long, outside of the search and of its time budget.
+ */
+void negamax_prepare(void);
+/* Called after each negamax_predict() in process context, with preemption
+ * enabled, to log what negamax_prepare() started measuring.
+ */
+void negamax_finish(void);
+/* Searches deeper and deeper while the move fits in its share of
+ * interval_ms, the time between two moves.
+ */
+move_t negamax_predict(char *table, char player, unsigned int interval_ms);
+/* Lines found by the last negamax_predict(), valid until the next one */
+const struct analysis *negamax_analysis(void);
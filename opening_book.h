@@ -0,0 +1,1606 @@
+/* Generated by kmldrv-book -d 6, do not edit */
+#pragma once
+
+#define BOOK_BOARD_SIZE 4
+#define BOOK_GOAL 3
+#define BOOK_ALLOW_EXCEED 1
+#define BOOK_DEPTH 6
+
+#define BOOK_SIZE 6942
+
+static const unsigned int opening_book_keys[BOOK_SIZE] = {
+    0x00000000, 0x00000001, 0x00000003, 0x00000005, 0x00000007, 0x0000000b,
+    0x0000000e, 0x0000000f, 0x00000010, 0x00000013, 0x00000016, 0x0000001d,
+    0x00000020, 0x00000022, 0x00000026, 0x0000002c, 0x00000032, 0x00000034,
+    0x00000044, 0x00000056, 0x00000057, 0x00000058, 0x0000005c, 0x00000060,
+    0x00000062, 0x00000063, 0x00000064, 0x00000066, 0x00000068, 0x0000006a,
+    0x0000006e, 0x00000072, 0x00000074, 0x0000007d, 0x0000007e, 0x00000080,
+    0x00000083, 0x00000084, 0x00000085, 0x00000087, 0x00000088, 0x0000008a,
+    0x0000008c, 0x0000008e, 0x00000090, 0x00000092, 0x00000095, 0x00000096,
+    0x00000097, 0x0000009a, 0x0000009c, 0x0000009d, 0x000000ab, 0x000000ac,
+    0x000000ae, 0x000000b0, 0x000000b2, 0x000000b8, 0x000000bd, 0x000000be,
+    0x000000c0, 0x000000c2, 0x000000c4, 0x000000c6, 0x000000c8, 0x000000cc,
+    0x000000cd, 0x000000d0, 0x000000d2, 0x000000d3, 0x000000dc, 0x000000e2,
+    0x000000e4, 0x000000f3, 0x000000f5, 0x000000f8, 0x000000f9, 0x000000fa,
+    0x000000fe, 0x00000102, 0x00000104, 0x00000105, 0x00000106, 0x00000108,
+    0x0000010a, 0x0000010c, 0x00000110, 0x00000114, 0x00000116, 0x0000011f,
+    0x00000120, 0x00000122, 0x00000125, 0x00000126, 0x00000127, 0x00000129,
+    0x0000012a, 0x0000012c, 0x0000012e, 0x00000130, 0x00000132, 0x00000134,
+    0x00000137, 0x00000138, 0x00000139, 0x0000013c, 0x0000013e, 0x0000013f,
+    0x0000014a, 0x0000014c, 0x00000155, 0x00000156, 0x00000158, 0x0000015b,
+    0x0000015c, 0x0000015d, 0x00000167, 0x00000173, 0x00000177, 0x0000017a,
+    0x0000017c, 0x0000017f, 0x00000180, 0x00000181, 0x00000185, 0x00000189,
+    0x0000018c, 0x0000018d, 0x0000018f, 0x0000019c, 0x0000019e, 0x000001a0,
+    0x000001a3, 0x000001a4, 0x000001a5, 0x000001a8, 0x000001aa, 0x000001ab,
+    0x000001b0, 0x000001b2, 0x000001b5, 0x000001b6, 0x000001b7, 0x000001bb,
+    0x000001bf, 0x000001c2, 0x000001c3, 0x000001c5, 0x000001cc, 0x000001ce,
+    0x000001cf, 0x000001d4, 0x000001d5, 0x000001d7, 0x000001e7, 0x000001e9,
+    0x000001ea, 0x000001ef, 0x000001f0, 0x000001f2, 0x000001f4, 0x000001f6,
+    0x000001fc, 0x00000201, 0x00000202, 0x00000204, 0x00000206, 0x00000208,
+    0x0000020a, 0x0000020c, 0x00000210, 0x00000211, 0x00000214, 0x00000216,
+    0x00000217, 0x00000220, 0x00000226, 0x00000228, 0x0000023a, 0x0000023c,
+    0x0000023e, 0x00000240, 0x00000242, 0x00000245, 0x00000246, 0x00000247,
+    0x0000024a, 0x0000024c, 0x0000024d, 0x00000252, 0x00000254, 0x00000257,
+    0x00000258, 0x00000259, 0x0000025d, 0x00000261, 0x00000264, 0x00000265,
+    0x00000267, 0x0000026e, 0x00000270, 0x00000271, 0x00000276, 0x00000277,
+    0x00000279, 0x00000292, 0x00000294, 0x000002a4, 0x000002a6, 0x000002a7,
+    0x000002ac, 0x000002ad, 0x0000032c, 0x00000330, 0x00000332, 0x0000033b,
+    0x0000033c, 0x0000033e, 0x00000341, 0x00000342, 0x00000343, 0x0000034d,
+    0x00000359, 0x0000035d, 0x00000360, 0x00000362, 0x00000365, 0x00000366,
+    0x00000367, 0x0000036b, 0x0000036f, 0x00000372, 0x00000373, 0x00000375,
+    0x0000037b, 0x0000037c, 0x0000037e, 0x00000380, 0x00000382, 0x00000384,
+    0x00000386, 0x00000389, 0x0000038a, 0x0000038b, 0x0000038e, 0x00000390,
+    0x00000391, 0x00000396, 0x00000398, 0x0000039b, 0x0000039c, 0x0000039d,
+    0x000003a1, 0x000003a5, 0x000003a8, 0x000003a9, 0x000003ab, 0x000003b2,
+    0x000003b4, 0x000003b5, 0x000003ba, 0x000003bb, 0x000003bd, 0x000003ce,
+    0x000003d2, 0x000003d4, 0x000003dd, 0x000003e0, 0x000003e3, 0x000003e4,
+    0x000003e5, 0x000003ef, 0x000003fb, 0x00000404, 0x00000407, 0x0000046e,
+    0x00000470, 0x00000473, 0x00000474, 0x00000475, 0x00000479, 0x0000047d,
+    0x00000480, 0x00000481, 0x00000483, 0x0000048b, 0x0000048f, 0x0000049b,
+    0x000004a4, 0x000004a5, 0x000004a7, 0x000004ad, 0x000004bf, 0x000004c0,
+    0x000004c2, 0x000004c4, 0x000004c6, 0x000004c8, 0x000004ca, 0x000004cd,
+    0x000004ce, 0x000004cf, 0x000004d2, 0x000004d4, 0x000004d5, 0x000004da,
+    0x000004dc, 0x000004df, 0x000004e0, 0x000004e1, 0x000004e5, 0x000004e9,
+    0x000004ec, 0x000004ed, 0x000004ef, 0x000004f6, 0x000004f8, 0x000004f9,
+    0x000004fe, 0x000004ff, 0x00000501, 0x00000510, 0x00000512, 0x00000515,
+    0x00000516, 0x00000517, 0x0000051b, 0x0000051f, 0x00000522, 0x00000523,
+    0x00000525, 0x0000052d, 0x00000531, 0x0000053d, 0x00000546, 0x00000547,
+    0x00000549, 0x0000054f, 0x00000562, 0x00000564, 0x00000565, 0x0000056a,
+    0x0000056b, 0x0000056d, 0x0000057c, 0x0000057d, 0x0000057f, 0x00000585,
+    0x00000603, 0x00000604, 0x00000606, 0x00000608, 0x0000060a, 0x0000060c,
+    0x0000060e, 0x00000611, 0x00000612, 0x00000613, 0x00000616, 0x00000618,
+    0x00000619, 0x0000061e, 0x00000620, 0x00000623, 0x00000624, 0x00000625,
+    0x00000629, 0x0000062d, 0x00000630, 0x00000631, 0x00000633, 0x0000063a,
+    0x0000063c, 0x0000063d, 0x00000642, 0x00000643, 0x00000645, 0x00000658,
+    0x0000065e, 0x00000660, 0x00000670, 0x00000672, 0x00000673, 0x00000678,
+    0x00000679, 0x000006f6, 0x000006f8, 0x000006fb, 0x000006fc, 0x000006fd,
+    0x00000701, 0x00000705, 0x00000708, 0x00000709, 0x0000070b, 0x00000713,
+    0x00000717, 0x00000723, 0x0000072c, 0x0000072d, 0x0000072f, 0x00000735,
+    0x00000748, 0x0000074a, 0x0000074b, 0x00000750, 0x00000751, 0x00000753,
+    0x00000762, 0x00000763, 0x00000765, 0x0000076b, 0x0000079c, 0x000007a2,
+    0x000007a4, 0x000007b4, 0x000007b7, 0x000007ea, 0x000007ec, 0x000007ed,
+    0x000007f2, 0x000007f3, 0x000007f5, 0x00000804, 0x00000805, 0x00000807,
+    0x0000080d, 0x000008de, 0x000008e2, 0x000008e4, 0x000008ed, 0x000008f0,
+    0x000008f3, 0x000008f4, 0x000008f5, 0x000008ff, 0x0000090b, 0x00000914,
+    0x00000917, 0x0000092d, 0x0000092e, 0x00000930, 0x00000932, 0x00000934,
+    0x00000936, 0x00000938, 0x0000093b, 0x0000093c, 0x0000093d, 0x00000940,
+    0x00000942, 0x00000943, 0x00000948, 0x0000094a, 0x0000094d, 0x0000094e,
+    0x0000094f, 0x00000953, 0x00000957, 0x0000095a, 0x0000095b, 0x0000095d,
+    0x00000964, 0x00000966, 0x00000967, 0x0000096c, 0x0000096d, 0x0000096f,
+    0x000009d7, 0x000009e3, 0x000009e7, 0x00000a07, 0x00000a0b, 0x00000a17,
+    0x00000a20, 0x00000a22, 0x00000a25, 0x00000a26, 0x00000a27, 0x00000a2b,
+    0x00000a2f, 0x00000a32, 0x00000a33, 0x00000a35, 0x00000a3d, 0x00000a41,
+    0x00000a4d, 0x00000a56, 0x00000a57, 0x00000a59, 0x00000a5f, 0x00000ac2,
+    0x00000ac4, 0x00000ac7, 0x00000ac8, 0x00000ac9, 0x00000acd, 0x00000ad1,
+    0x00000ad4, 0x00000ad5, 0x00000ad7, 0x00000adf, 0x00000ae3, 0x00000aef,
+    0x00000af8, 0x00000af9, 0x00000afb, 0x00000b01, 0x00000b14, 0x00000b16,
+    0x00000b17, 0x00000b1c, 0x00000b1d, 0x00000b1f, 0x00000b2e, 0x00000b2f,
+    0x00000b31, 0x00000b37, 0x00000c06, 0x00000c08, 0x00000c0b, 0x00000c0c,
+    0x00000c0d, 0x00000c11, 0x00000c15, 0x00000c18, 0x00000c19, 0x00000c1b,
+    0x00000c23, 0x00000c27, 0x00000c33, 0x00000c3c, 0x00000c3d, 0x00000c3f,
+    0x00000c45, 0x00000d9d, 0x00000da1, 0x00000dad, 0x00000dd1, 0x00000dec,
+    0x00000ded, 0x00000def, 0x00000df5, 0x00000e07, 0x00000ee0, 0x00000ee2,
+    0x00000ee3, 0x00000ee8, 0x00000ee9, 0x00000eeb, 0x00000efa, 0x00000efb,
+    0x00000efd, 0x00000f03, 0x00000fd2, 0x00000fd3, 0x00000fd5, 0x00000fdb,
+    0x00000fed, 0x00001074, 0x00001075, 0x00001077, 0x000011bc, 0x000011c2,
+    0x000011c4, 0x000011d4, 0x000011d7, 0x000012ac, 0x000012ae, 0x000012af,
+    0x000012b4, 0x000012b5, 0x000012b7, 0x000012c6, 0x000012c7, 0x000012c9,
+    0x000012cf, 0x00001584, 0x00001585, 0x00001587, 0x000019ac, 0x000019b0,
+    0x000019b2, 0x000019b3, 0x000019b4, 0x000019b6, 0x000019b8, 0x000019ba,
+    0x000019be, 0x000019c2, 0x000019c4, 0x000019cd, 0x000019ce, 0x000019d0,
+    0x000019d3, 0x000019d4, 0x000019d5, 0x000019d7, 0x000019d8, 0x000019da,
+    0x000019dc, 0x000019de, 0x000019e0, 0x000019e2, 0x000019e5, 0x000019e6,
+    0x000019e7, 0x000019ea, 0x000019ec, 0x000019ed, 0x00001a03, 0x00001a04,
+    0x00001a06, 0x00001a09, 0x00001a0a, 0x00001a15, 0x00001a21, 0x00001a25,
+    0x00001a28, 0x00001a2a, 0x00001a2d, 0x00001a2e, 0x00001a33, 0x00001a37,
+    0x00001a3a, 0x00001a3d, 0x00001a52, 0x00001a53, 0x00001a56, 0x00001a58,
+    0x00001a59, 0x00001a5e, 0x00001a60, 0x00001a63, 0x00001a64, 0x00001a65,
+    0x00001a69, 0x00001a6d, 0x00001a70, 0x00001a71, 0x00001a73, 0x00001a7a,
+    0x00001a7c, 0x00001a7d, 0x00001a82, 0x00001a83, 0x00001a85, 0x00001aa6,
+    0x00001aa8, 0x00001aab, 0x00001aac, 0x00001aad, 0x00001ab7, 0x00001ac3,
+    0x00001ac7, 0x00001aca, 0x00001acc, 0x00001acf, 0x00001ad0, 0x00001ad1,
+    0x00001adc, 0x00001add, 0x00001adf, 0x00001af9, 0x00001afd, 0x00001b1d,
+    0x00001b21, 0x00001b2d, 0x00001b48, 0x00001b49, 0x00001b4b, 0x00001b53,
+    0x00001b57, 0x00001b63, 0x00001b6c, 0x00001b6d, 0x00001b6f, 0x00001b90,
+    0x00001b92, 0x00001b95, 0x00001b96, 0x00001b97, 0x00001b9a, 0x00001b9c,
+    0x00001b9d, 0x00001ba2, 0x00001ba4, 0x00001ba7, 0x00001ba8, 0x00001ba9,
+    0x00001bad, 0x00001bb1, 0x00001bb4, 0x00001bb5, 0x00001bb7, 0x00001bbe,
+    0x00001bc0, 0x00001bc1, 0x00001bc6, 0x00001bc7, 0x00001bc9, 0x00001be7,
+    0x00001bea, 0x00001bed, 0x00001bf5, 0x00001bf9, 0x00001c05, 0x00001c0e,
+    0x00001c11, 0x00001c17, 0x00001c44, 0x00001c45, 0x00001c47, 0x00001c4d,
+    0x00001c7c, 0x00001c80, 0x00001c82, 0x00001c8b, 0x00001c8c, 0x00001c8e,
+    0x00001c91, 0x00001c92, 0x00001c93, 0x00001c9d, 0x00001ca9, 0x00001cad,
+    0x00001cb0, 0x00001cb2, 0x00001cb5, 0x00001cb6, 0x00001cb7, 0x00001cbb,
+    0x00001cbf, 0x00001cc2, 0x00001cc3, 0x00001cc5, 0x00001cd3, 0x00001cdf,
+    0x00001ce3, 0x00001d03, 0x00001d07, 0x00001d13, 0x00001d1c, 0x00001d1e,
+    0x00001d21, 0x00001d22, 0x00001d23, 0x00001d27, 0x00001d2b, 0x00001d2e,
+    0x00001d2f, 0x00001d31, 0x00001d39, 0x00001d3d, 0x00001d49, 0x00001d52,
+    0x00001d53, 0x00001d55, 0x00001d5b, 0x00001d75, 0x00001d81, 0x00001d85,
+    0x00001da5, 0x00001da9, 0x00001db5, 0x00001e11, 0x00001e15, 0x00001e21,
+    0x00001e45, 0x00001e60, 0x00001e62, 0x00001e65, 0x00001e66, 0x00001e67,
+    0x00001e6b, 0x00001e6f, 0x00001e72, 0x00001e73, 0x00001e75, 0x00001e7d,
+    0x00001e81, 0x00001e8d, 0x00001e96, 0x00001e97, 0x00001e99, 0x00001e9f,
+    0x00001eb3, 0x00001eb7, 0x00001ec3, 0x00001ee7, 0x00001f02, 0x00001f03,
+    0x00001f05, 0x00001f0b, 0x00001f1d, 0x00001f53, 0x00001f54, 0x00001f56,
+    0x00001f58, 0x00001f5a, 0x00001f5c, 0x00001f5e, 0x00001f61, 0x00001f62,
+    0x00001f63, 0x00001f66, 0x00001f68, 0x00001f69, 0x00001f6e, 0x00001f70,
+    0x00001f73, 0x00001f74, 0x00001f75, 0x00001f79, 0x00001f7d, 0x00001f80,
+    0x00001f81, 0x00001f83, 0x00001f8a, 0x00001f8c, 0x00001f8d, 0x00001f92,
+    0x00001f93, 0x00001f95, 0x00001fa4, 0x00001fa6, 0x00001fa9, 0x00001faa,
+    0x00001faf, 0x00001fb3, 0x00001fb6, 0x00001fb9, 0x00001fc1, 0x00001fc5,
+    0x00001fd1, 0x00001fda, 0x00001fdd, 0x00001fe3, 0x00001ff6, 0x00001ff8,
+    0x00001ff9, 0x00001ffe, 0x00001fff, 0x00002001, 0x00002010, 0x00002011,
+    0x00002013, 0x00002019, 0x00002046, 0x00002048, 0x0000204b, 0x0000204c,
+    0x0000204d, 0x00002058, 0x00002059, 0x0000205b, 0x00002063, 0x00002067,
+    0x00002073, 0x0000207c, 0x0000207d, 0x0000207f, 0x00002099, 0x0000209d,
+    0x000020a9, 0x000020cd, 0x000020e8, 0x000020e9, 0x000020eb, 0x00002103,
+    0x0000213a, 0x0000213c, 0x0000213d, 0x00002142, 0x00002143, 0x00002145,
+    0x00002154, 0x00002155, 0x00002157, 0x0000215d, 0x0000218a, 0x0000218d,
+    0x00002193, 0x000021a5, 0x0000222e, 0x00002232, 0x00002234, 0x0000223d,
+    0x0000223e, 0x00002240, 0x00002243, 0x00002244, 0x00002245, 0x0000224f,
+    0x0000225b, 0x0000225f, 0x00002262, 0x00002264, 0x00002267, 0x00002268,
+    0x00002269, 0x0000226d, 0x00002271, 0x00002274, 0x00002275, 0x00002277,
+    0x00002285, 0x00002291, 0x00002295, 0x000022b5, 0x000022b9, 0x000022c5,
+    0x000022ce, 0x000022d0, 0x000022d3, 0x000022d4, 0x000022d5, 0x000022d9,
+    0x000022dd, 0x000022e0, 0x000022e1, 0x000022e3, 0x000022eb, 0x000022ef,
+    0x000022fb, 0x00002304, 0x00002305, 0x00002307, 0x0000230d, 0x00002327,
+    0x00002333, 0x00002337, 0x00002357, 0x0000235b, 0x00002367, 0x000023c3,
+    0x000023c7, 0x000023d3, 0x000023f7, 0x00002412, 0x00002414, 0x00002417,
+    0x00002418, 0x00002419, 0x0000241d, 0x00002421, 0x00002424, 0x00002425,
+    0x00002427, 0x0000242f, 0x00002433, 0x0000243f, 0x00002448, 0x00002449,
+    0x0000244b, 0x00002451, 0x00002465, 0x00002469, 0x00002475, 0x00002499,
+    0x000024b4, 0x000024b5, 0x000024b7, 0x000024bd, 0x000024cf, 0x0000250d,
+    0x00002519, 0x0000251d, 0x0000253d, 0x00002541, 0x0000254d, 0x000025a9,
+    0x000025ad, 0x000025b9, 0x000025dd, 0x000026ed, 0x000026f1, 0x000026fd,
+    0x00002721, 0x0000278d, 0x000027de, 0x000027e0, 0x000027e3, 0x000027e4,
+    0x000027e5, 0x000027e9, 0x000027ed, 0x000027f0, 0x000027f1, 0x000027f3,
+    0x000027fb, 0x000027ff, 0x0000280b, 0x00002814, 0x00002815, 0x00002817,
+    0x0000281d, 0x00002831, 0x00002835, 0x00002841, 0x00002865, 0x00002880,
+    0x00002881, 0x00002883, 0x00002889, 0x0000289b, 0x000028d3, 0x000028d7,
+    0x000028e3, 0x00002907, 0x00002973, 0x000029c4, 0x000029c5, 0x000029c7,
+    0x000029cd, 0x000029df, 0x00002a15, 0x00002ab7, 0x00002ab8, 0x00002aba,
+    0x00002abc, 0x00002abe, 0x00002ac0, 0x00002ac2, 0x00002ac5, 0x00002ac6,
+    0x00002ac7, 0x00002aca, 0x00002acc, 0x00002acd, 0x00002ad2, 0x00002ad4,
+    0x00002ad7, 0x00002ad8, 0x00002ad9, 0x00002add, 0x00002ae1, 0x00002ae4,
+    0x00002ae5, 0x00002ae7, 0x00002aee, 0x00002af0, 0x00002af1, 0x00002af6,
+    0x00002af7, 0x00002af9, 0x00002b08, 0x00002b0a, 0x00002b0d, 0x00002b0e,
+    0x00002b13, 0x00002b17, 0x00002b1a, 0x00002b1d, 0x00002b25, 0x00002b29,
+    0x00002b35, 0x00002b3e, 0x00002b41, 0x00002b47, 0x00002b5a, 0x00002b5c,
+    0x00002b5d, 0x00002b62, 0x00002b63, 0x00002b65, 0x00002b74, 0x00002b75,
+    0x00002b77, 0x00002b7d, 0x00002baa, 0x00002bac, 0x00002baf, 0x00002bb0,
+    0x00002bb1, 0x00002bbc, 0x00002bbd, 0x00002bbf, 0x00002bc7, 0x00002bcb,
+    0x00002bd7, 0x00002be0, 0x00002be1, 0x00002be3, 0x00002bfd, 0x00002c01,
+    0x00002c0d, 0x00002c31, 0x00002c4c, 0x00002c4d, 0x00002c4f, 0x00002c67,
+    0x00002c9e, 0x00002ca0, 0x00002ca1, 0x00002ca6, 0x00002ca7, 0x00002ca9,
+    0x00002cb8, 0x00002cb9, 0x00002cbb, 0x00002cc1, 0x00002cee, 0x00002cf1,
+    0x00002cf7, 0x00002d09, 0x00002d90, 0x00002d92, 0x00002d95, 0x00002d96,
+    0x00002d97, 0x00002d9b, 0x00002d9f, 0x00002da2, 0x00002da3, 0x00002da5,
+    0x00002dad, 0x00002db1, 0x00002dbd, 0x00002dc6, 0x00002dc7, 0x00002dc9,
+    0x00002dcf, 0x00002de3, 0x00002de7, 0x00002df3, 0x00002e17, 0x00002e32,
+    0x00002e33, 0x00002e35, 0x00002e3b, 0x00002e4d, 0x00002e85, 0x00002e89,
+    0x00002e95, 0x00002eb9, 0x00002f25, 0x00002f76, 0x00002f77, 0x00002f79,
+    0x00002f7f, 0x00002f91, 0x00002fc7, 0x0000306a, 0x0000306c, 0x0000306d,
+    0x00003072, 0x00003073, 0x00003075, 0x00003084, 0x00003085, 0x00003087,
+    0x0000308d, 0x000030ba, 0x000030bd, 0x000030c3, 0x000030d5, 0x0000315c,
+    0x0000315d, 0x0000315f, 0x00003177, 0x000031ad, 0x00003358, 0x0000335d,
+    0x0000335e, 0x00003360, 0x00003362, 0x00003364, 0x00003366, 0x00003368,
+    0x0000336c, 0x0000336d, 0x00003370, 0x00003372, 0x00003373, 0x0000337c,
+    0x00003382, 0x00003384, 0x000033a8, 0x000033a9, 0x000033ae, 0x000033b0,
+    0x000033b3, 0x000033b4, 0x000033b5, 0x000033b9, 0x000033bd, 0x000033c0,
+    0x000033c1, 0x000033c3, 0x000033ca, 0x000033cc, 0x000033cd, 0x000033d2,
+    0x000033d3, 0x000033d5, 0x00003400, 0x00003402, 0x00003403, 0x00003408,
+    0x00003409, 0x00003448, 0x0000344a, 0x0000344b, 0x00003450, 0x00003452,
+    0x00003455, 0x00003456, 0x00003457, 0x0000345b, 0x0000345f, 0x00003462,
+    0x00003463, 0x00003465, 0x0000346c, 0x0000346e, 0x0000346f, 0x00003474,
+    0x00003475, 0x00003477, 0x0000349b, 0x000034a3, 0x000034a7, 0x000034b3,
+    0x000034bc, 0x000034bd, 0x000034bf, 0x000034c5, 0x000034f2, 0x000034f3,
+    0x000034f5, 0x000034fb, 0x00003544, 0x00003546, 0x00003547, 0x0000354c,
+    0x0000354d, 0x00003594, 0x00003595, 0x00003597, 0x0000359d, 0x0000361b,
+    0x0000361c, 0x0000361e, 0x00003620, 0x00003622, 0x00003624, 0x00003626,
+    0x00003629, 0x0000362a, 0x0000362b, 0x0000362e, 0x00003630, 0x00003631,
+    0x00003636, 0x00003638, 0x0000363b, 0x0000363c, 0x0000363d, 0x00003641,
+    0x00003645, 0x00003648, 0x00003649, 0x0000364b, 0x00003652, 0x00003654,
+    0x00003655, 0x0000365a, 0x0000365b, 0x0000365d, 0x0000366c, 0x0000366e,
+    0x00003671, 0x00003672, 0x00003673, 0x00003677, 0x0000367b, 0x0000367e,
+    0x0000367f, 0x00003681, 0x00003689, 0x0000368d, 0x00003699, 0x000036a2,
+    0x000036a3, 0x000036a5, 0x000036ab, 0x000036be, 0x000036c0, 0x000036c1,
+    0x000036c6, 0x000036c7, 0x000036c9, 0x000036d8, 0x000036d9, 0x000036db,
+    0x000036e1, 0x0000370e, 0x00003710, 0x00003713, 0x00003714, 0x00003715,
+    0x00003719, 0x0000371d, 0x00003720, 0x00003721, 0x00003723, 0x0000372b,
+    0x0000372f, 0x0000373b, 0x00003744, 0x00003745, 0x00003747, 0x0000374d,
+    0x000037b0, 0x000037b1, 0x000037b3, 0x000037b9, 0x000037cb, 0x00003802,
+    0x00003804, 0x00003805, 0x0000380a, 0x0000380b, 0x0000380d, 0x0000381c,
+    0x0000381d, 0x0000381f, 0x00003825, 0x00003852, 0x00003853, 0x00003855,
+    0x0000385b, 0x0000386d, 0x000038f8, 0x000038fe, 0x00003900, 0x00003910,
+    0x00003912, 0x00003913, 0x00003918, 0x00003919, 0x00003946, 0x00003948,
+    0x00003949, 0x0000394e, 0x0000394f, 0x00003951, 0x00003960, 0x00003961,
+    0x00003963, 0x00003969, 0x000039e8, 0x000039ea, 0x000039eb, 0x000039f0,
+    0x000039f1, 0x000039f3, 0x00003a02, 0x00003a03, 0x00003a05, 0x00003a0b,
+    0x00003a38, 0x00003a39, 0x00003a3b, 0x00003a41, 0x00003a53, 0x00003bce,
+    0x00003bd0, 0x00003bd2, 0x00003bd4, 0x00003bd6, 0x00003bd8, 0x00003bdb,
+    0x00003bdc, 0x00003bdd, 0x00003be0, 0x00003be2, 0x00003be3, 0x00003be8,
+    0x00003bea, 0x00003bed, 0x00003bee, 0x00003bef, 0x00003bf3, 0x00003bf7,
+    0x00003bfa, 0x00003bfb, 0x00003bfd, 0x00003c04, 0x00003c06, 0x00003c07,
+    0x00003c0c, 0x00003c0d, 0x00003c0f, 0x00003c1e, 0x00003c20, 0x00003c23,
+    0x00003c24, 0x00003c25, 0x00003c29, 0x00003c2d, 0x00003c30, 0x00003c31,
+    0x00003c33, 0x00003c3b, 0x00003c3f, 0x00003c4b, 0x00003c54, 0x00003c55,
+    0x00003c57, 0x00003c5d, 0x00003c70, 0x00003c72, 0x00003c73, 0x00003c78,
+    0x00003c79, 0x00003c7b, 0x00003c8a, 0x00003c8b, 0x00003c8d, 0x00003c93,
+    0x00003cc0, 0x00003cc2, 0x00003cc5, 0x00003cc6, 0x00003cc7, 0x00003ccb,
+    0x00003ccf, 0x00003cd2, 0x00003cd3, 0x00003cd5, 0x00003cdd, 0x00003ce1,
+    0x00003ced, 0x00003cf6, 0x00003cf7, 0x00003cf9, 0x00003cff, 0x00003d13,
+    0x00003d17, 0x00003d23, 0x00003d47, 0x00003d62, 0x00003d63, 0x00003d65,
+    0x00003d6b, 0x00003d7d, 0x00003db4, 0x00003db6, 0x00003db7, 0x00003dbc,
+    0x00003dbd, 0x00003dbf, 0x00003dce, 0x00003dcf, 0x00003dd1, 0x00003dd7,
+    0x00003e04, 0x00003e05, 0x00003e07, 0x00003e0d, 0x00003e1f, 0x00003ea6,
+    0x00003ea8, 0x00003eab, 0x00003eac, 0x00003ead, 0x00003eb1, 0x00003eb5,
+    0x00003eb8, 0x00003eb9, 0x00003ebb, 0x00003ec3, 0x00003ec7, 0x00003ed3,
+    0x00003edc, 0x00003edd, 0x00003edf, 0x00003ee5, 0x00003ef9, 0x00003efd,
+    0x00003f09, 0x00003f2d, 0x00003f48, 0x00003f49, 0x00003f4b, 0x00003f51,
+    0x00003f63, 0x0000408c, 0x0000408d, 0x0000408f, 0x00004095, 0x000040a7,
+    0x000040dd, 0x00004180, 0x00004182, 0x00004183, 0x00004188, 0x00004189,
+    0x0000418b, 0x0000419a, 0x0000419b, 0x0000419d, 0x000041a3, 0x000041d0,
+    0x000041d1, 0x000041d3, 0x000041d9, 0x000041eb, 0x00004272, 0x00004273,
+    0x00004275, 0x0000427b, 0x0000428d, 0x000042c3, 0x0000445c, 0x00004462,
+    0x00004464, 0x00004474, 0x00004476, 0x00004477, 0x0000447c, 0x0000447d,
+    0x000044aa, 0x000044ac, 0x000044ad, 0x000044b2, 0x000044b3, 0x000044b5,
+    0x000044c4, 0x000044c5, 0x000044c7, 0x000044cd, 0x0000454c, 0x0000454e,
+    0x0000454f, 0x00004554, 0x00004555, 0x00004557, 0x00004566, 0x00004567,
+    0x00004569, 0x0000456f, 0x0000459c, 0x0000459d, 0x0000459f, 0x000045a5,
+    0x000045b7, 0x00004732, 0x00004734, 0x00004735, 0x0000473a, 0x0000473b,
+    0x0000473d, 0x0000474c, 0x0000474d, 0x0000474f, 0x00004755, 0x00004782,
+    0x00004783, 0x00004785, 0x0000478b, 0x0000479d, 0x00004824, 0x00004825,
+    0x00004827, 0x0000482d, 0x0000483f, 0x00004d00, 0x00004d04, 0x00004d06,
+    0x00004d0f, 0x00004d10, 0x00004d12, 0x00004d15, 0x00004d16, 0x00004d17,
+    0x00004d19, 0x00004d1a, 0x00004d1c, 0x00004d1e, 0x00004d20, 0x00004d22,
+    0x00004d24, 0x00004d27, 0x00004d28, 0x00004d29, 0x00004d2c, 0x00004d2e,
+    0x00004d2f, 0x00004d57, 0x00004d63, 0x00004d67, 0x00004d6a, 0x00004d6c,
+    0x00004d6f, 0x00004d70, 0x00004d71, 0x00004d75, 0x00004d79, 0x00004d7c,
+    0x00004d7d, 0x00004d7f, 0x00004da0, 0x00004da2, 0x00004da5, 0x00004da6,
+    0x00004da7, 0x00004dab, 0x00004daf, 0x00004db2, 0x00004db3, 0x00004db5,
+    0x00004dbc, 0x00004dbe, 0x00004dbf, 0x00004dc4, 0x00004dc5, 0x00004dc7,
+    0x00004df9, 0x00004e05, 0x00004e09, 0x00004e0c, 0x00004e0e, 0x00004e12,
+    0x00004e13, 0x00004e17, 0x00004e1b, 0x00004e1e, 0x00004e1f, 0x00004e5f,
+    0x00004e63, 0x00004e6f, 0x00004e95, 0x00004e99, 0x00004ea5, 0x00004eae,
+    0x00004eaf, 0x00004eb7, 0x00004ee4, 0x00004ee6, 0x00004ee9, 0x00004eea,
+    0x00004eeb, 0x00004eef, 0x00004ef3, 0x00004ef6, 0x00004ef7, 0x00004ef9,
+    0x00004f00, 0x00004f02, 0x00004f03, 0x00004f08, 0x00004f09, 0x00004f0b,
+    0x00004f37, 0x00004f3b, 0x00004f47, 0x00004f50, 0x00004f51, 0x00004f53,
+    0x00004f59, 0x00004f86, 0x00004f87, 0x00004f89, 0x00004f8f, 0x00004fbe,
+    0x00004fc2, 0x00004fc4, 0x00004fcd, 0x00004fce, 0x00004fd0, 0x00004fd3,
+    0x00004fd4, 0x00004fd5, 0x00004ff2, 0x00004ff4, 0x00004ff7, 0x00004ff8,
+    0x00004ff9, 0x00004ffd, 0x00005001, 0x00005004, 0x00005005, 0x00005007,
+    0x00005015, 0x00005021, 0x00005025, 0x00005045, 0x00005049, 0x00005055,
+    0x00005064, 0x00005065, 0x00005069, 0x0000506d, 0x00005070, 0x00005071,
+    0x00005073, 0x00005094, 0x00005095, 0x00005097, 0x0000509d, 0x000050b7,
+    0x000050c3, 0x000050c7, 0x000050e7, 0x000050eb, 0x000050f7, 0x00005157,
+    0x00005163, 0x00005187, 0x000051a2, 0x000051a4, 0x000051a7, 0x000051a8,
+    0x000051a9, 0x000051ad, 0x000051b1, 0x000051b4, 0x000051b5, 0x000051b7,
+    0x000051d8, 0x000051d9, 0x000051db, 0x000051e1, 0x000051f9, 0x00005205,
+    0x00005229, 0x0000524d, 0x00005295, 0x00005296, 0x00005298, 0x0000529a,
+    0x0000529c, 0x0000529e, 0x000052a0, 0x000052a3, 0x000052a4, 0x000052a5,
+    0x000052a8, 0x000052aa, 0x000052ab, 0x000052b0, 0x000052b2, 0x000052b5,
+    0x000052b6, 0x000052b7, 0x000052bb, 0x000052bf, 0x000052c2, 0x000052c3,
+    0x000052c5, 0x000052cc, 0x000052ce, 0x000052cf, 0x000052d4, 0x000052d5,
+    0x000052d7, 0x000052e6, 0x000052e8, 0x000052eb, 0x000052ec, 0x000052ed,
+    0x000052f1, 0x000052f5, 0x000052f8, 0x000052f9, 0x000052fb, 0x00005303,
+    0x00005307, 0x00005313, 0x0000531c, 0x0000531d, 0x0000531f, 0x00005325,
+    0x00005338, 0x0000533a, 0x0000533b, 0x00005340, 0x00005341, 0x00005343,
+    0x00005352, 0x00005353, 0x00005355, 0x0000535b, 0x00005388, 0x0000538a,
+    0x0000538e, 0x0000538f, 0x00005393, 0x00005397, 0x0000539a, 0x0000539b,
+    0x000053a5, 0x000053a9, 0x000053b5, 0x000053be, 0x000053bf, 0x000053c7,
+    0x000053db, 0x000053df, 0x000053eb, 0x0000540f, 0x0000542a, 0x0000542b,
+    0x00005433, 0x00005445, 0x0000547c, 0x0000547e, 0x0000547f, 0x00005484,
+    0x00005485, 0x00005487, 0x00005496, 0x00005497, 0x00005499, 0x0000549f,
+    0x000054cc, 0x000054cd, 0x000054cf, 0x000054d5, 0x000054e7, 0x00005570,
+    0x00005574, 0x00005576, 0x0000557f, 0x00005580, 0x00005582, 0x00005585,
+    0x00005586, 0x00005587, 0x00005591, 0x0000559d, 0x000055a1, 0x000055a6,
+    0x000055a9, 0x000055aa, 0x000055ab, 0x000055af, 0x000055b3, 0x000055b6,
+    0x000055b7, 0x000055b9, 0x000055c7, 0x000055d3, 0x000055d7, 0x000055f7,
+    0x000055fb, 0x00005607, 0x00005610, 0x00005612, 0x00005615, 0x00005616,
+    0x00005617, 0x0000561b, 0x0000561f, 0x00005622, 0x00005623, 0x00005625,
+    0x0000562d, 0x00005631, 0x0000563d, 0x00005646, 0x00005647, 0x00005649,
+    0x0000564f, 0x00005669, 0x00005675, 0x00005679, 0x00005699, 0x0000569d,
+    0x000056a9, 0x00005705, 0x00005709, 0x00005715, 0x00005739, 0x00005754,
+    0x00005756, 0x00005759, 0x0000575a, 0x0000575b, 0x0000575f, 0x00005763,
+    0x00005766, 0x00005767, 0x00005769, 0x00005771, 0x00005775, 0x00005781,
+    0x0000578a, 0x0000578b, 0x0000578d, 0x00005793, 0x000057a7, 0x000057ab,
+    0x000057b7, 0x000057db, 0x000057f6, 0x000057f7, 0x000057f9, 0x000057ff,
+    0x00005811, 0x0000584f, 0x0000585b, 0x0000585f, 0x0000587f, 0x00005883,
+    0x0000588f, 0x000058eb, 0x000058ef, 0x000058fb, 0x0000591f, 0x00005a2f,
+    0x00005a33, 0x00005a3f, 0x00005a63, 0x00005acf, 0x00005b22, 0x00005b25,
+    0x00005b26, 0x00005b27, 0x00005b2b, 0x00005b2f, 0x00005b32, 0x00005b33,
+    0x00005b35, 0x00005b3d, 0x00005b41, 0x00005b4d, 0x00005b57, 0x00005b59,
+    0x00005b5f, 0x00005b73, 0x00005b77, 0x00005b83, 0x00005ba7, 0x00005bc2,
+    0x00005bc3, 0x00005bc5, 0x00005bcb, 0x00005bdd, 0x00005c15, 0x00005c19,
+    0x00005c25, 0x00005c49, 0x00005cb5, 0x00005d06, 0x00005d07, 0x00005d09,
+    0x00005d0f, 0x00005d21, 0x00005d57, 0x00005dfa, 0x00005dfc, 0x00005dfe,
+    0x00005e00, 0x00005e04, 0x00005e07, 0x00005e08, 0x00005e09, 0x00005e0c,
+    0x00005e0e, 0x00005e0f, 0x00005e16, 0x00005e19, 0x00005e1a, 0x00005e1b,
+    0x00005e1f, 0x00005e23, 0x00005e26, 0x00005e27, 0x00005e29, 0x00005e30,
+    0x00005e32, 0x00005e33, 0x00005e39, 0x00005e3b, 0x00005e4a, 0x00005e4c,
+    0x00005e4f, 0x00005e50, 0x00005e51, 0x00005e55, 0x00005e59, 0x00005e5c,
+    0x00005e5d, 0x00005e5f, 0x00005e67, 0x00005e6b, 0x00005e77, 0x00005e80,
+    0x00005e81, 0x00005e83, 0x00005e89, 0x00005e9c, 0x00005e9e, 0x00005e9f,
+    0x00005ea4, 0x00005ea5, 0x00005ea7, 0x00005eb6, 0x00005eb7, 0x00005eb9,
+    0x00005ebf, 0x00005eec, 0x00005eee, 0x00005ef2, 0x00005ef3, 0x00005ef7,
+    0x00005efb, 0x00005efe, 0x00005eff, 0x00005f09, 0x00005f0d, 0x00005f19,
+    0x00005f22, 0x00005f23, 0x00005f2b, 0x00005f3f, 0x00005f43, 0x00005f4f,
+    0x00005f73, 0x00005f8e, 0x00005f8f, 0x00005f97, 0x00005fa9, 0x00005fe0,
+    0x00005fe2, 0x00005fe3, 0x00005fe8, 0x00005fe9, 0x00005feb, 0x00005ffa,
+    0x00005ffb, 0x00005ffd, 0x00006003, 0x00006030, 0x00006031, 0x00006033,
+    0x00006039, 0x0000604b, 0x000060d4, 0x000060d7, 0x000060d8, 0x000060d9,
+    0x000060dd, 0x000060e1, 0x000060e4, 0x000060e5, 0x000060e7, 0x00006109,
+    0x0000610b, 0x00006125, 0x00006129, 0x00006135, 0x00006159, 0x00006174,
+    0x00006175, 0x00006177, 0x0000617d, 0x000061c7, 0x000061cb, 0x000061d7,
+    0x000061fb, 0x00006267, 0x000062b8, 0x000062b9, 0x000062bb, 0x000062c1,
+    0x00006309, 0x000063ac, 0x000063ae, 0x000063af, 0x000063b5, 0x000063b7,
+    0x000063c7, 0x000063c9, 0x000063fc, 0x000063fd, 0x000063ff, 0x00006405,
+    0x00006417, 0x0000649e, 0x0000649f, 0x000064a7, 0x000064b9, 0x000064ef,
+    0x000066a7, 0x000066b3, 0x000066b7, 0x000066ba, 0x000066bc, 0x000066bf,
+    0x000066c0, 0x000066c1, 0x000066c5, 0x000066c9, 0x000066cc, 0x000066cd,
+    0x000066cf, 0x0000670d, 0x00006711, 0x0000671d, 0x00006743, 0x00006747,
+    0x00006753, 0x0000675c, 0x0000675d, 0x0000675f, 0x00006765, 0x000067af,
+    0x000067b3, 0x000067bf, 0x0000684f, 0x00006887, 0x0000688b, 0x00006897,
+    0x000068a0, 0x000068a1, 0x000068a3, 0x000068a9, 0x000068f1, 0x00006927,
+    0x00006971, 0x00006975, 0x00006995, 0x00006999, 0x000069a5, 0x00006a11,
+    0x00006a35, 0x00006b55, 0x00006b79, 0x00006c36, 0x00006c38, 0x00006c3b,
+    0x00006c3c, 0x00006c3d, 0x00006c41, 0x00006c45, 0x00006c48, 0x00006c49,
+    0x00006c4b, 0x00006c53, 0x00006c57, 0x00006c63, 0x00006c6c, 0x00006c6d,
+    0x00006c6f, 0x00006c75, 0x00006c89, 0x00006c8d, 0x00006c99, 0x00006cbd,
+    0x00006cd8, 0x00006cd9, 0x00006cdb, 0x00006ce1, 0x00006cf3, 0x00006d2b,
+    0x00006d2f, 0x00006d3b, 0x00006d5f, 0x00006dcb, 0x00006e1c, 0x00006e1d,
+    0x00006e1f, 0x00006e25, 0x00006e37, 0x00006e6d, 0x00006f17, 0x00006f23,
+    0x00006f27, 0x00006f47, 0x00006f4b, 0x00006f57, 0x00006fb3, 0x00006fb7,
+    0x00006fc3, 0x00006fe7, 0x000070f7, 0x000070fb, 0x00007107, 0x0000712b,
+    0x00007197, 0x000074c3, 0x000074c7, 0x000074d3, 0x000074f7, 0x00007563,
+    0x000076a7, 0x0000779c, 0x0000779f, 0x000077a0, 0x000077a1, 0x000077a5,
+    0x000077a9, 0x000077ac, 0x000077ad, 0x000077af, 0x000077b7, 0x000077bb,
+    0x000077c7, 0x000077d0, 0x000077d1, 0x000077d3, 0x000077d9, 0x000077ed,
+    0x000077f1, 0x000077fd, 0x00007821, 0x0000783c, 0x0000783d, 0x0000783f,
+    0x00007845, 0x00007857, 0x0000788f, 0x00007893, 0x0000789f, 0x000078c3,
+    0x0000792f, 0x00007980, 0x00007981, 0x00007983, 0x00007989, 0x0000799b,
+    0x000079d1, 0x00007a75, 0x00007a79, 0x00007a85, 0x00007aa9, 0x00007b15,
+    0x00007c59, 0x00007d4c, 0x00007d4d, 0x00007d4f, 0x00007d55, 0x00007d67,
+    0x00007d9d, 0x00007e3f, 0x00008040, 0x00008042, 0x00008045, 0x00008046,
+    0x00008047, 0x0000804b, 0x0000804f, 0x00008052, 0x00008053, 0x00008055,
+    0x0000805c, 0x0000805e, 0x0000805f, 0x00008064, 0x00008065, 0x00008067,
+    0x00008093, 0x00008097, 0x000080a3, 0x000080ac, 0x000080ad, 0x000080af,
+    0x000080b5, 0x000080e2, 0x000080e3, 0x000080e5, 0x000080eb, 0x00008135,
+    0x00008139, 0x00008145, 0x0000814e, 0x0000814f, 0x00008157, 0x0000819f,
+    0x000081d5, 0x00008226, 0x00008227, 0x00008229, 0x0000822f, 0x00008277,
+    0x00008310, 0x00008311, 0x00008313, 0x00008334, 0x00008335, 0x00008337,
+    0x0000833d, 0x00008385, 0x00008403, 0x00008427, 0x000085d8, 0x000085da,
+    0x000085db, 0x000085e0, 0x000085e1, 0x000085e3, 0x000085f2, 0x000085f3,
+    0x000085f5, 0x000085fb, 0x00008628, 0x00008629, 0x0000862b, 0x00008631,
+    0x00008643, 0x000086ca, 0x000086cb, 0x000086d3, 0x000086e5, 0x0000871b,
+    0x000088b2, 0x000088b5, 0x000088b6, 0x000088b7, 0x000088bb, 0x000088bf,
+    0x000088c2, 0x000088c3, 0x000088c5, 0x000088cd, 0x000088d1, 0x000088dd,
+    0x000088e6, 0x000088e7, 0x000088e9, 0x000088ef, 0x00008903, 0x00008907,
+    0x00008913, 0x00008937, 0x00008952, 0x00008953, 0x00008955, 0x0000895b,
+    0x0000896d, 0x000089a5, 0x000089a9, 0x000089b5, 0x000089d9, 0x00008a45,
+    0x00008a96, 0x00008a97, 0x00008a99, 0x00008a9f, 0x00008ab1, 0x00008ae7,
+    0x00008b8b, 0x00008b8f, 0x00008b9b, 0x00008bbf, 0x00008c2b, 0x00008d6f,
+    0x00008e62, 0x00008e63, 0x00008e65, 0x00008e6b, 0x00008e7d, 0x00008eb3,
+    0x00008f55, 0x0000913c, 0x0000913e, 0x0000913f, 0x00009144, 0x00009145,
+    0x00009147, 0x00009156, 0x00009157, 0x00009159, 0x0000915f, 0x0000918c,
+    0x0000918d, 0x0000918f, 0x00009195, 0x000091a7, 0x0000922e, 0x0000922f,
+    0x00009237, 0x00009249, 0x0000927f, 0x00009414, 0x00009415, 0x00009417,
+    0x0000941d, 0x00009465, 0x00009507, 0x000099e1, 0x000099e2, 0x000099e4,
+    0x000099e6, 0x000099e8, 0x000099ea, 0x000099ec, 0x000099f0, 0x000099f1,
+    0x000099f4, 0x000099f6, 0x000099f7, 0x00009a00, 0x00009a06, 0x00009a08,
+    0x00009a32, 0x00009a34, 0x00009a37, 0x00009a38, 0x00009a39, 0x00009a3d,
+    0x00009a41, 0x00009a44, 0x00009a45, 0x00009a47, 0x00009a4e, 0x00009a50,
+    0x00009a51, 0x00009a56, 0x00009a57, 0x00009a59, 0x00009a84, 0x00009a86,
+    0x00009a87, 0x00009a8c, 0x00009a8d, 0x00009ad4, 0x00009ad6, 0x00009ad9,
+    0x00009ada, 0x00009adb, 0x00009adf, 0x00009ae3, 0x00009ae6, 0x00009ae7,
+    0x00009ae9, 0x00009af0, 0x00009af2, 0x00009af3, 0x00009af8, 0x00009af9,
+    0x00009afb, 0x00009b27, 0x00009b2b, 0x00009b37, 0x00009b40, 0x00009b41,
+    0x00009b43, 0x00009b49, 0x00009b76, 0x00009b77, 0x00009b79, 0x00009b7f,
+    0x00009bc8, 0x00009bca, 0x00009bcb, 0x00009bd0, 0x00009bd1, 0x00009c18,
+    0x00009c19, 0x00009c1b, 0x00009c21, 0x00009cba, 0x00009cbc, 0x00009cbf,
+    0x00009cc0, 0x00009cc1, 0x00009cc5, 0x00009cc9, 0x00009ccc, 0x00009ccd,
+    0x00009ccf, 0x00009cd6, 0x00009cd8, 0x00009cd9, 0x00009cde, 0x00009cdf,
+    0x00009ce1, 0x00009d0d, 0x00009d11, 0x00009d1d, 0x00009d26, 0x00009d27,
+    0x00009d29, 0x00009d2f, 0x00009d5c, 0x00009d5d, 0x00009d5f, 0x00009d65,
+    0x00009daf, 0x00009db3, 0x00009dbf, 0x00009dc8, 0x00009dc9, 0x00009dcb,
+    0x00009dd1, 0x00009e4f, 0x00009ea0, 0x00009ea1, 0x00009ea3, 0x00009ea9,
+    0x00009ef1, 0x00009f7c, 0x00009f82, 0x00009f84, 0x00009f94, 0x00009f96,
+    0x00009f97, 0x00009f9c, 0x00009f9d, 0x00009fcc, 0x00009fcd, 0x00009fd2,
+    0x00009fd3, 0x00009fd5, 0x00009fe4, 0x00009fe5, 0x00009fe7, 0x00009fed,
+    0x0000a06c, 0x0000a06e, 0x0000a06f, 0x0000a074, 0x0000a075, 0x0000a077,
+    0x0000a086, 0x0000a087, 0x0000a089, 0x0000a08f, 0x0000a0bf, 0x0000a0c5,
+    0x0000a0d7, 0x0000a252, 0x0000a254, 0x0000a256, 0x0000a258, 0x0000a25a,
+    0x0000a25c, 0x0000a25f, 0x0000a260, 0x0000a261, 0x0000a264, 0x0000a266,
+    0x0000a267, 0x0000a26e, 0x0000a271, 0x0000a272, 0x0000a273, 0x0000a277,
+    0x0000a27b, 0x0000a27e, 0x0000a27f, 0x0000a281, 0x0000a288, 0x0000a28a,
+    0x0000a28b, 0x0000a290, 0x0000a291, 0x0000a293, 0x0000a2a2, 0x0000a2a4,
+    0x0000a2a7, 0x0000a2a8, 0x0000a2a9, 0x0000a2ad, 0x0000a2b1, 0x0000a2b4,
+    0x0000a2b5, 0x0000a2b7, 0x0000a2bf, 0x0000a2c3, 0x0000a2cf, 0x0000a2d8,
+    0x0000a2d9, 0x0000a2db, 0x0000a2e1, 0x0000a2f4, 0x0000a2f6, 0x0000a2f7,
+    0x0000a2fc, 0x0000a2fd, 0x0000a2ff, 0x0000a30e, 0x0000a30f, 0x0000a311,
+    0x0000a317, 0x0000a344, 0x0000a346, 0x0000a349, 0x0000a34a, 0x0000a34b,
+    0x0000a34f, 0x0000a353, 0x0000a356, 0x0000a357, 0x0000a359, 0x0000a361,
+    0x0000a365, 0x0000a371, 0x0000a37a, 0x0000a37b, 0x0000a37d, 0x0000a383,
+    0x0000a397, 0x0000a39b, 0x0000a3a7, 0x0000a3cb, 0x0000a3e6, 0x0000a3e7,
+    0x0000a3e9, 0x0000a3ef, 0x0000a401, 0x0000a438, 0x0000a43a, 0x0000a43b,
+    0x0000a440, 0x0000a441, 0x0000a443, 0x0000a452, 0x0000a453, 0x0000a455,
+    0x0000a45b, 0x0000a488, 0x0000a489, 0x0000a48b, 0x0000a491, 0x0000a4a3,
+    0x0000a52c, 0x0000a52f, 0x0000a530, 0x0000a531, 0x0000a535, 0x0000a539,
+    0x0000a53c, 0x0000a53d, 0x0000a53f, 0x0000a547, 0x0000a54b, 0x0000a557,
+    0x0000a561, 0x0000a563, 0x0000a569, 0x0000a57d, 0x0000a581, 0x0000a58d,
+    0x0000a5b1, 0x0000a5cc, 0x0000a5cd, 0x0000a5cf, 0x0000a5d5, 0x0000a5e7,
+    0x0000a710, 0x0000a711, 0x0000a713, 0x0000a719, 0x0000a72b, 0x0000a761,
+    0x0000a804, 0x0000a806, 0x0000a807, 0x0000a80c, 0x0000a80d, 0x0000a80f,
+    0x0000a81f, 0x0000a821, 0x0000a827, 0x0000a854, 0x0000a855, 0x0000a857,
+    0x0000a85d, 0x0000a86f, 0x0000a8f6, 0x0000a8f7, 0x0000a8f9, 0x0000a8ff,
+    0x0000a911, 0x0000a947, 0x0000aae0, 0x0000aae6, 0x0000aae8, 0x0000aaf8,
+    0x0000aafa, 0x0000aafb, 0x0000ab01, 0x0000ab2e, 0x0000ab30, 0x0000ab31,
+    0x0000ab36, 0x0000ab37, 0x0000ab39, 0x0000ab48, 0x0000ab49, 0x0000ab4b,
+    0x0000ab51, 0x0000abd0, 0x0000abd2, 0x0000abd3, 0x0000abd8, 0x0000abd9,
+    0x0000abdb, 0x0000abea, 0x0000abeb, 0x0000abed, 0x0000abf3, 0x0000ac20,
+    0x0000ac21, 0x0000ac23, 0x0000ac29, 0x0000ac3b, 0x0000adb6, 0x0000adb8,
+    0x0000adb9, 0x0000adbf, 0x0000adc1, 0x0000add1, 0x0000add3, 0x0000ae06,
+    0x0000ae07, 0x0000ae09, 0x0000ae0f, 0x0000ae21, 0x0000aea8, 0x0000aea9,
+    0x0000aeab, 0x0000aeb1, 0x0000aec3, 0x0000b382, 0x0000b384, 0x0000b387,
+    0x0000b388, 0x0000b389, 0x0000b38d, 0x0000b391, 0x0000b394, 0x0000b395,
+    0x0000b397, 0x0000b39e, 0x0000b3a0, 0x0000b3a1, 0x0000b3a6, 0x0000b3a7,
+    0x0000b3a9, 0x0000b3d5, 0x0000b3d9, 0x0000b3e5, 0x0000b3ee, 0x0000b3f1,
+    0x0000b3f7, 0x0000b424, 0x0000b425, 0x0000b427, 0x0000b42d, 0x0000b477,
+    0x0000b47b, 0x0000b487, 0x0000b490, 0x0000b491, 0x0000b493, 0x0000b4e1,
+    0x0000b517, 0x0000b568, 0x0000b569, 0x0000b56b, 0x0000b571, 0x0000b5b9,
+    0x0000b65d, 0x0000b661, 0x0000b66d, 0x0000b676, 0x0000b677, 0x0000b679,
+    0x0000b67f, 0x0000b6c7, 0x0000b6fd, 0x0000b769, 0x0000b841, 0x0000b922,
+    0x0000b923, 0x0000b925, 0x0000b934, 0x0000b935, 0x0000b937, 0x0000b93d,
+    0x0000b985, 0x0000ba27, 0x0000bbf4, 0x0000bbf7, 0x0000bbf8, 0x0000bbf9,
+    0x0000bbfd, 0x0000bc01, 0x0000bc04, 0x0000bc05, 0x0000bc07, 0x0000bc0f,
+    0x0000bc13, 0x0000bc1f, 0x0000bc28, 0x0000bc29, 0x0000bc2b, 0x0000bc31,
+    0x0000bc45, 0x0000bc49, 0x0000bc55, 0x0000bc79, 0x0000bc94, 0x0000bc95,
+    0x0000bc97, 0x0000bc9d, 0x0000bcaf, 0x0000bce7, 0x0000bceb, 0x0000bcf7,
+    0x0000bd1b, 0x0000bd87, 0x0000bdd8, 0x0000bdd9, 0x0000bddb, 0x0000bde1,
+    0x0000bdf3, 0x0000be29, 0x0000becd, 0x0000bed1, 0x0000bedd, 0x0000bf01,
+    0x0000bf6d, 0x0000c0b1, 0x0000c1a4, 0x0000c1a5, 0x0000c1a7, 0x0000c1ad,
+    0x0000c1bf, 0x0000c1f5, 0x0000c297, 0x0000c47e, 0x0000c480, 0x0000c481,
+    0x0000c486, 0x0000c487, 0x0000c489, 0x0000c498, 0x0000c499, 0x0000c49b,
+    0x0000c4a1, 0x0000c4ce, 0x0000c4d1, 0x0000c4d7, 0x0000c4e9, 0x0000c570,
+    0x0000c571, 0x0000c573, 0x0000c58b, 0x0000c5c1, 0x0000c757, 0x0000c759,
+    0x0000c75f, 0x0000c771, 0x0000c7a7, 0x0000c849, 0x0000cd24, 0x0000cd26,
+    0x0000cd27, 0x0000cd2c, 0x0000cd2d, 0x0000cd74, 0x0000cd75, 0x0000cd77,
+    0x0000cd7d, 0x0000ce16, 0x0000ce17, 0x0000ce19, 0x0000ce1f, 0x0000ce67,
+    0x0000cffc, 0x0000cffd, 0x0000cfff, 0x0000d005, 0x0000d04d, 0x0000d0ef,
+    0x0000d594, 0x0000d596, 0x0000d597, 0x0000d59c, 0x0000d59d, 0x0000d59f,
+    0x0000d5ae, 0x0000d5af, 0x0000d5b1, 0x0000d5b7, 0x0000d5e4, 0x0000d5e5,
+    0x0000d5e7, 0x0000d5ed, 0x0000d5ff, 0x0000d686, 0x0000d687, 0x0000d689,
+    0x0000d68f, 0x0000d6a1, 0x0000d6d7, 0x0000d86d, 0x0000d86f, 0x0000d875,
+    0x0000d887, 0x0000d8bd, 0x0001005b, 0x0001005c, 0x0001005e, 0x00010061,
+    0x00010062, 0x00010063, 0x0001006d, 0x00010079, 0x0001007d, 0x00010080,
+    0x00010082, 0x00010085, 0x00010086, 0x00010087, 0x0001008b, 0x0001008f,
+    0x00010092, 0x00010093, 0x00010095, 0x000100af, 0x000100b3, 0x000100d3,
+    0x000100d7, 0x000100e3, 0x000100fb, 0x000100fe, 0x000100ff, 0x00010101,
+    0x00010109, 0x0001010d, 0x00010119, 0x00010122, 0x00010123, 0x00010125,
+    0x0001012b, 0x00010151, 0x00010155, 0x00010175, 0x00010179, 0x00010185,
+    0x000101f1, 0x00010215, 0x0001023b, 0x0001023f, 0x00010242, 0x00010243,
+    0x00010245, 0x0001024d, 0x00010251, 0x0001025d, 0x00010266, 0x00010267,
+    0x00010269, 0x0001026f, 0x00010293, 0x000102b7, 0x000102ed, 0x0001032b,
+    0x00010337, 0x0001033b, 0x0001035b, 0x0001035f, 0x0001036b, 0x000103c7,
+    0x000103cb, 0x000103d7, 0x000103fb, 0x0001050b, 0x0001050f, 0x0001051b,
+    0x0001053f, 0x000105ab, 0x000105fe, 0x00010601, 0x00010602, 0x00010603,
+    0x00010607, 0x0001060b, 0x0001060e, 0x0001060f, 0x00010611, 0x00010619,
+    0x0001061d, 0x00010629, 0x00010632, 0x00010633, 0x00010635, 0x0001063b,
+    0x0001064f, 0x00010653, 0x0001065f, 0x00010683, 0x0001069e, 0x0001069f,
+    0x000106a1, 0x000106a7, 0x000106b9, 0x000106f1, 0x000106f5, 0x00010701,
+    0x00010725, 0x00010791, 0x000107e2, 0x000107e3, 0x000107e5, 0x000107eb,
+    0x000107fd, 0x00010833, 0x000108dd, 0x000108e9, 0x000108ed, 0x0001090d,
+    0x00010911, 0x0001091d, 0x00010979, 0x0001097d, 0x00010989, 0x000109ad,
+    0x00010abd, 0x00010ac1, 0x00010acd, 0x00010af1, 0x00010b5d, 0x00010e89,
+    0x00010e8d, 0x00010e99, 0x00010ebd, 0x00010f29, 0x0001106d, 0x00011162,
+    0x00011165, 0x00011166, 0x00011167, 0x0001116b, 0x0001116f, 0x00011172,
+    0x00011173, 0x00011175, 0x0001117d, 0x00011181, 0x0001118d, 0x00011196,
+    0x00011197, 0x00011199, 0x0001119f, 0x000111b3, 0x000111b7, 0x000111c3,
+    0x000111e7, 0x00011202, 0x00011203, 0x00011205, 0x0001120b, 0x0001121d,
+    0x00011255, 0x00011259, 0x00011265, 0x00011289, 0x000112f5, 0x00011346,
+    0x00011347, 0x00011349, 0x0001134f, 0x00011361, 0x00011397, 0x0001143b,
+    0x0001143f, 0x0001144b, 0x0001146f, 0x000114db, 0x0001161f, 0x00011713,
+    0x00011715, 0x0001171b, 0x0001172d, 0x00011763, 0x00011805, 0x000119fe,
+    0x00011a00, 0x00011a01, 0x00011a06, 0x00011a08, 0x00011a0b, 0x00011a0c,
+    0x00011a0d, 0x00011a11, 0x00011a15, 0x00011a18, 0x00011a19, 0x00011a1b,
+    0x00011a22, 0x00011a24, 0x00011a25, 0x00011a2a, 0x00011a2b, 0x00011a2d,
+    0x00011a51, 0x00011a59, 0x00011a5d, 0x00011a69, 0x00011a72, 0x00011a73,
+    0x00011a75, 0x00011a7b, 0x00011aa8, 0x00011aa9, 0x00011aab, 0x00011ab1,
+    0x00011af0, 0x00011af3, 0x00011afb, 0x00011aff, 0x00011b0b, 0x00011b14,
+    0x00011b17, 0x00011b1d, 0x00011b65, 0x00011b9b, 0x00011bec, 0x00011bed,
+    0x00011bef, 0x00011bf5, 0x00011c3d, 0x00011cc6, 0x00011cc9, 0x00011cca,
+    0x00011ccb, 0x00011cd6, 0x00011cd7, 0x00011cd9, 0x00011ce1, 0x00011ce5,
+    0x00011cf1, 0x00011cfa, 0x00011cfb, 0x00011cfd, 0x00011d17, 0x00011d1b,
+    0x00011d27, 0x00011d4b, 0x00011d66, 0x00011d67, 0x00011d69, 0x00011d81,
+    0x00011db9, 0x00011dbd, 0x00011dc9, 0x00011ded, 0x00011e59, 0x00011eaa,
+    0x00011eab, 0x00011ead, 0x00011ec5, 0x00011efb, 0x00011f9e, 0x00011fa0,
+    0x00011fa1, 0x00011fa6, 0x00011fa7, 0x00011fa9, 0x00011fb8, 0x00011fb9,
+    0x00011fbb, 0x00011fc1, 0x00011fee, 0x00011fef, 0x00011ff1, 0x00011ff7,
+    0x00012009, 0x00012090, 0x00012093, 0x00012099, 0x000120ab, 0x000120e1,
+    0x00012278, 0x0001227b, 0x0001227c, 0x0001227d, 0x00012281, 0x00012285,
+    0x00012288, 0x00012289, 0x0001228b, 0x00012293, 0x00012297, 0x000122a3,
+    0x000122ac, 0x000122ad, 0x000122af, 0x000122b5, 0x000122c9, 0x000122cd,
+    0x000122d9, 0x000122fd, 0x00012318, 0x00012319, 0x0001231b, 0x00012321,
+    0x00012333, 0x0001236b, 0x0001236f, 0x0001237b, 0x0001239f, 0x0001240b,
+    0x0001245c, 0x0001245d, 0x0001245f, 0x00012465, 0x00012477, 0x000124ad,
+    0x00012551, 0x00012555, 0x00012561, 0x00012585, 0x000125f1, 0x00012735,
+    0x00012829, 0x0001282b, 0x00012831, 0x00012843, 0x00012879, 0x0001291b,
+    0x00012b02, 0x00012b04, 0x00012b05, 0x00012b0a, 0x00012b0b, 0x00012b0d,
+    0x00012b1c, 0x00012b1d, 0x00012b1f, 0x00012b25, 0x00012b52, 0x00012b53,
+    0x00012b55, 0x00012b5b, 0x00012b6d, 0x00012bf4, 0x00012bf7, 0x00012bfd,
+    0x00012c0f, 0x00012c45, 0x00012ddb, 0x00012ddd, 0x00012df5, 0x00012e2b,
+    0x00012ecd, 0x000133af, 0x000133bb, 0x000133c4, 0x000133c7, 0x00013415,
+    0x00013419, 0x00013425, 0x0001344b, 0x0001344f, 0x0001345b, 0x00013464,
+    0x00013465, 0x00013467, 0x0001346d, 0x000134b7, 0x000134bb, 0x000134c7,
+    0x00013557, 0x0001358f, 0x00013593, 0x0001359f, 0x000135a8, 0x000135a9,
+    0x000135ab, 0x000135b1, 0x000135f9, 0x0001362f, 0x0001370d, 0x00013719,
+    0x0001373d, 0x0001384d, 0x00013851, 0x0001385d, 0x00013881, 0x00013991,
+    0x00013995, 0x000139a1, 0x000139c5, 0x000139e0, 0x000139e1, 0x000139e3,
+    0x000139e9, 0x000139fb, 0x00013ad3, 0x00013b24, 0x00013b25, 0x00013b27,
+    0x00013b75, 0x00013cbb, 0x00013cbf, 0x00013ccb, 0x00013cef, 0x00013e9f,
+    0x0001426b, 0x00014544, 0x00014545, 0x00014547, 0x00014637, 0x000166eb,
+    0x000166ef, 0x000166fb, 0x00016704, 0x00016705, 0x00016707, 0x0001670d,
+    0x00016755, 0x0001678b, 0x000167f7, 0x000168cf, 0x000169b9, 0x000169dd,
+    0x00016c81, 0x00016c83, 0x00016c89, 0x00016c9b, 0x00016cd1, 0x00016d73,
+    0x00016f5b, 0x00016f5f, 0x00016f6b, 0x00016f8f, 0x00016ffb, 0x0001713f,
+    0x000177e5, 0x000177e7, 0x000177ed, 0x000177ff, 0x00017835, 0x0001808c,
+    0x0001808f, 0x00018090, 0x00018091, 0x00018095, 0x00018099, 0x0001809d,
+    0x0001809f, 0x000180a6, 0x000180a8, 0x000180a9, 0x000180af, 0x000180b1,
+    0x000180dd, 0x000180e1, 0x000180ed, 0x000180f6, 0x000180f7, 0x000180f9,
+    0x000180ff, 0x0001812c, 0x0001812d, 0x0001812f, 0x00018135, 0x0001817f,
+    0x00018183, 0x0001818f, 0x00018198, 0x0001819b, 0x000181a1, 0x000181e9,
+    0x0001821f, 0x00018270, 0x00018271, 0x00018273, 0x00018279, 0x000182c1,
+    0x00018365, 0x00018369, 0x0001837f, 0x00018381, 0x000183cf, 0x00018405,
+    0x00018471, 0x00018549, 0x00018622, 0x00018624, 0x00018625, 0x0001862b,
+    0x0001862d, 0x0001863d, 0x0001863f, 0x00018675, 0x0001867b, 0x0001868d,
+    0x00018714, 0x00018717, 0x0001871d, 0x0001872f, 0x000188fc, 0x000188ff,
+    0x00018900, 0x00018901, 0x00018905, 0x00018909, 0x0001890d, 0x0001890f,
+    0x00018917, 0x0001891b, 0x00018931, 0x00018933, 0x0001894d, 0x00018951,
+    0x0001895d, 0x00018981, 0x0001899c, 0x0001899d, 0x0001899f, 0x000189a5,
+    0x000189b7, 0x000189ef, 0x000189f3, 0x000189ff, 0x00018a8f, 0x00018ae0,
+    0x00018ae1, 0x00018ae3, 0x00018ae9, 0x00018afb, 0x00018b31, 0x00018bd5,
+    0x00018bd9, 0x00018c75, 0x00018db9, 0x00018ead, 0x00018eaf, 0x00018efd,
+    0x00019186, 0x00019188, 0x00019189, 0x0001918f, 0x00019191, 0x000191a1,
+    0x000191a3, 0x000191d6, 0x000191d7, 0x000191d9, 0x000191df, 0x000191f1,
+    0x0001927b, 0x000192c9, 0x0001945f, 0x00019461, 0x000194af, 0x00019a2d,
+    0x00019a31, 0x00019a3d, 0x00019a46, 0x00019a47, 0x00019a49, 0x00019a4f,
+    0x00019a97, 0x00019acd, 0x00019b39, 0x00019c11, 0x00019d1f, 0x00019fcb,
+    0x00019fdd, 0x0001a29d, 0x0001a2a1, 0x0001a2ad, 0x0001a2d1, 0x0001a33d,
+    0x0001a481, 0x0001ab27, 0x0001ab29, 0x0001ab2f, 0x0001ab41, 0x0001ab77,
+    0x0001b3cc, 0x0001b3cd, 0x0001b3cf, 0x0001b3d5, 0x0001b41d, 0x0001b4bf,
+    0x0001b6a5, 0x0001bc3d, 0x0001bc3f, 0x0001bc45, 0x0001bc57, 0x0001bc8d,
+    0x0001e6fc, 0x0001e6fe, 0x0001e701, 0x0001e702, 0x0001e703, 0x0001e706,
+    0x0001e708, 0x0001e709, 0x0001e70e, 0x0001e710, 0x0001e713, 0x0001e714,
+    0x0001e715, 0x0001e719, 0x0001e71d, 0x0001e720, 0x0001e721, 0x0001e723,
+    0x0001e72a, 0x0001e72c, 0x0001e72d, 0x0001e732, 0x0001e733, 0x0001e735,
+    0x0001e753, 0x0001e756, 0x0001e759, 0x0001e761, 0x0001e765, 0x0001e771,
+    0x0001e77a, 0x0001e77d, 0x0001e783, 0x0001e7b0, 0x0001e7b1, 0x0001e7b3,
+    0x0001e7b9, 0x0001e7f8, 0x0001e7f9, 0x0001e7fb, 0x0001e803, 0x0001e807,
+    0x0001e813, 0x0001e81c, 0x0001e81d, 0x0001e81f, 0x0001e849, 0x0001e86d,
+    0x0001e8a3, 0x0001e8e2, 0x0001e8e3, 0x0001e8e5, 0x0001e8f4, 0x0001e8f5,
+    0x0001e8f7, 0x0001e8fd, 0x0001e945, 0x0001e9d7, 0x0001e9db, 0x0001e9de,
+    0x0001e9df, 0x0001e9e1, 0x0001e9e9, 0x0001e9ed, 0x0001e9f9, 0x0001ea02,
+    0x0001ea03, 0x0001ea05, 0x0001ea0b, 0x0001ea2f, 0x0001ea53, 0x0001ea77,
+    0x0001ea89, 0x0001ead1, 0x0001eaf5, 0x0001ebbb, 0x0001ebcd, 0x0001eca6,
+    0x0001eca8, 0x0001eca9, 0x0001ecae, 0x0001ecaf, 0x0001ecb1, 0x0001ecc0,
+    0x0001ecc1, 0x0001ecc3, 0x0001ecc9, 0x0001ecf6, 0x0001ecf9, 0x0001ecff,
+    0x0001ed11, 0x0001ed99, 0x0001ed9b, 0x0001edb3, 0x0001ede9, 0x0001ef80,
+    0x0001ef83, 0x0001ef84, 0x0001ef85, 0x0001ef89, 0x0001ef8d, 0x0001ef90,
+    0x0001ef91, 0x0001ef93, 0x0001ef9b, 0x0001ef9f, 0x0001efab, 0x0001efb4,
+    0x0001efb5, 0x0001efb7, 0x0001efbd, 0x0001efd1, 0x0001efd5, 0x0001efe1,
+    0x0001f005, 0x0001f020, 0x0001f021, 0x0001f023, 0x0001f029, 0x0001f03b,
+    0x0001f073, 0x0001f077, 0x0001f083, 0x0001f0a7, 0x0001f113, 0x0001f164,
+    0x0001f165, 0x0001f167, 0x0001f16d, 0x0001f17f, 0x0001f1b5, 0x0001f259,
+    0x0001f25d, 0x0001f269, 0x0001f28d, 0x0001f2f9, 0x0001f43d, 0x0001f531,
+    0x0001f533, 0x0001f539, 0x0001f54b, 0x0001f581, 0x0001f80a, 0x0001f80c,
+    0x0001f80d, 0x0001f812, 0x0001f813, 0x0001f815, 0x0001f824, 0x0001f825,
+    0x0001f827, 0x0001f82d, 0x0001f85a, 0x0001f85d, 0x0001f863, 0x0001f875,
+    0x0001f8fd, 0x0001f8ff, 0x0001f917, 0x0001f94d, 0x0001fae3, 0x0001fae5,
+    0x0001faeb, 0x0001fafd, 0x0001fb33, 0x000200b0, 0x000200b2, 0x000200b3,
+    0x000200b8, 0x000200b9, 0x00020100, 0x00020101, 0x00020103, 0x00020109,
+    0x000201a2, 0x000201a3, 0x000201a5, 0x000201ab, 0x000201f3, 0x00020376,
+    0x00020377, 0x00020379, 0x00020388, 0x00020389, 0x0002038b, 0x00020391,
+    0x000203c7, 0x000203d9, 0x00020469, 0x0002047b, 0x00020920, 0x00020922,
+    0x00020923, 0x00020928, 0x00020929, 0x0002092b, 0x0002093a, 0x0002093b,
+    0x0002093d, 0x00020943, 0x00020970, 0x00020971, 0x00020973, 0x00020979,
+    0x0002098b, 0x00020a13, 0x00020a15, 0x00020a1b, 0x00020a2d, 0x00020a63,
+    0x00020bf9, 0x00020bfb, 0x00020c01, 0x00020c13, 0x00020c49, 0x000233f3,
+    0x000233f7, 0x00023403, 0x0002340c, 0x0002340d, 0x0002340f, 0x00023415,
+    0x0002345d, 0x00023493, 0x000234ff, 0x000235d7, 0x000236c1, 0x000236e5,
+    0x00023989, 0x0002398b, 0x00023991, 0x000239a3, 0x00023c63, 0x00023c67,
+    0x00023c73, 0x00023c97, 0x00023d03, 0x000244ed, 0x000244ef, 0x000244f5,
+    0x00024507, 0x0002453d, 0x00024d92, 0x00024d93, 0x00024d95, 0x00024d9b,
+    0x00024de3, 0x00024e85, 0x00025603, 0x00025605, 0x0002560b, 0x0002561d,
+    0x00025653, 0x00026734, 0x00026737, 0x00026784, 0x00026785, 0x00026787,
+    0x0002678d, 0x00026827, 0x00026877, 0x00026a5d, 0x00026ff4, 0x00026ff5,
+    0x00026ff7, 0x000270e7, 0x000280d4, 0x000280d5, 0x000280d7, 0x000280dd,
+    0x00028125, 0x000281c7, 0x000283ad, 0x00028945, 0x00028947, 0x0002894d,
+    0x0002895f, 0x00028995, 0x0002cd9e, 0x0002cda2, 0x0002cda4, 0x0002cdad,
+    0x0002cdb0, 0x0002cdb3, 0x0002cdb4, 0x0002cdb5, 0x0002cdbf, 0x0002cdcb,
+    0x0002cdd4, 0x0002cdd7, 0x0002cdf5, 0x0002ce01, 0x0002ce05, 0x0002ce25,
+    0x0002ce29, 0x0002ce35, 0x0002ce40, 0x0002ce43, 0x0002ce44, 0x0002ce45,
+    0x0002ce49, 0x0002ce4d, 0x0002ce50, 0x0002ce51, 0x0002ce53, 0x0002ce5b,
+    0x0002ce5f, 0x0002ce6b, 0x0002ce74, 0x0002ce75, 0x0002ce77, 0x0002ce7d,
+    0x0002ce97, 0x0002cea3, 0x0002cea7, 0x0002cec7, 0x0002cecb, 0x0002ced7,
+    0x0002cf33, 0x0002cf37, 0x0002cf43, 0x0002cf67, 0x0002cf84, 0x0002cf87,
+    0x0002cf88, 0x0002cf89, 0x0002cf8d, 0x0002cf91, 0x0002cf94, 0x0002cf95,
+    0x0002cf97, 0x0002cf9f, 0x0002cfa3, 0x0002cfaf, 0x0002cfb8, 0x0002cfb9,
+    0x0002cfbb, 0x0002cfc1, 0x0002cfd5, 0x0002cfd9, 0x0002cfe5, 0x0002d009,
+    0x0002d025, 0x0002d027, 0x0002d02d, 0x0002d03f, 0x0002d119, 0x0002d11d,
+    0x0002d129, 0x0002d14d, 0x0002d25d, 0x0002d261, 0x0002d26d, 0x0002d291,
+    0x0002d3a1, 0x0002d3a5, 0x0002d3b1, 0x0002d3d5, 0x0002d3f1, 0x0002d3f3,
+    0x0002d3f9, 0x0002d40b, 0x0002d535, 0x0002d537, 0x0002d6cb, 0x0002d6cf,
+    0x0002d6db, 0x0002d6ff, 0x0002d8af, 0x0002dc7b, 0x0002df54, 0x0002df55,
+    0x0002df57, 0x0002e047, 0x0002e73e, 0x0002e740, 0x0002e742, 0x0002e744,
+    0x0002e746, 0x0002e748, 0x0002e74b, 0x0002e74c, 0x0002e74d, 0x0002e750,
+    0x0002e752, 0x0002e753, 0x0002e758, 0x0002e75a, 0x0002e75d, 0x0002e75e,
+    0x0002e75f, 0x0002e763, 0x0002e767, 0x0002e76a, 0x0002e76b, 0x0002e76d,
+    0x0002e774, 0x0002e776, 0x0002e777, 0x0002e77c, 0x0002e77d, 0x0002e77f,
+    0x0002e790, 0x0002e793, 0x0002e794, 0x0002e795, 0x0002e799, 0x0002e79d,
+    0x0002e7a0, 0x0002e7a1, 0x0002e7a3, 0x0002e7ab, 0x0002e7af, 0x0002e7bb,
+    0x0002e7c4, 0x0002e7c5, 0x0002e7c7, 0x0002e7cd, 0x0002e7e0, 0x0002e7e2,
+    0x0002e7e3, 0x0002e7e8, 0x0002e7e9, 0x0002e7eb, 0x0002e7fa, 0x0002e7fb,
+    0x0002e7fd, 0x0002e803, 0x0002e832, 0x0002e835, 0x0002e836, 0x0002e837,
+    0x0002e83b, 0x0002e83f, 0x0002e842, 0x0002e843, 0x0002e845, 0x0002e84d,
+    0x0002e851, 0x0002e85d, 0x0002e866, 0x0002e867, 0x0002e869, 0x0002e86f,
+    0x0002e883, 0x0002e887, 0x0002e893, 0x0002e8b7, 0x0002e8d3, 0x0002e8d5,
+    0x0002e8db, 0x0002e8ed, 0x0002e924, 0x0002e926, 0x0002e927, 0x0002e92c,
+    0x0002e92d, 0x0002e92f, 0x0002e93e, 0x0002e93f, 0x0002e941, 0x0002e947,
+    0x0002e975, 0x0002e977, 0x0002e97d, 0x0002e98f, 0x0002ea18, 0x0002ea1c,
+    0x0002ea1d, 0x0002ea21, 0x0002ea25, 0x0002ea28, 0x0002ea29, 0x0002ea33,
+    0x0002ea37, 0x0002ea43, 0x0002ea4c, 0x0002ea4d, 0x0002ea55, 0x0002ea69,
+    0x0002ea6d, 0x0002ea79, 0x0002ea9d, 0x0002eab9, 0x0002eac1, 0x0002ead3,
+    0x0002eb0b, 0x0002eb0f, 0x0002eb1b, 0x0002eb3f, 0x0002ebfd, 0x0002ec05,
+    0x0002ec17, 0x0002ecf0, 0x0002ecf2, 0x0002ecf3, 0x0002ecf8, 0x0002ecf9,
+    0x0002ecfb, 0x0002ed0a, 0x0002ed0b, 0x0002ed0d, 0x0002ed13, 0x0002ed41,
+    0x0002ed43, 0x0002ed49, 0x0002ed5b, 0x0002ede3, 0x0002ede5, 0x0002edeb,
+    0x0002edfd, 0x0002efca, 0x0002efcd, 0x0002efce, 0x0002efcf, 0x0002efd3,
+    0x0002efd7, 0x0002efda, 0x0002efdb, 0x0002efdd, 0x0002effe, 0x0002efff,
+    0x0002f001, 0x0002f007, 0x0002f01b, 0x0002f01f, 0x0002f02b, 0x0002f04f,
+    0x0002f06a, 0x0002f06b, 0x0002f06d, 0x0002f073, 0x0002f0bd, 0x0002f0c1,
+    0x0002f0cd, 0x0002f0f1, 0x0002f15d, 0x0002f1af, 0x0002f1b1, 0x0002f1b7,
+    0x0002f1ff, 0x0002f2a3, 0x0002f2a7, 0x0002f2b3, 0x0002f2d7, 0x0002f343,
+    0x0002f57b, 0x0002f57d, 0x0002f583, 0x0002f5cb, 0x0002f854, 0x0002f856,
+    0x0002f857, 0x0002f85c, 0x0002f85d, 0x0002f85f, 0x0002f86e, 0x0002f86f,
+    0x0002f871, 0x0002f877, 0x0002f8a4, 0x0002f8a5, 0x0002f8a7, 0x0002f8ad,
+    0x0002f8bf, 0x0002f947, 0x0002f949, 0x0002f94f, 0x0002f961, 0x0002f997,
+    0x0002fb2d, 0x0002fb35, 0x0002fb47, 0x0002fb7d, 0x00031a87, 0x00031a93,
+    0x00031a97, 0x00031ab7, 0x00031abb, 0x00031ac7, 0x00031b23, 0x00031b27,
+    0x00031b33, 0x00031b57, 0x00031c67, 0x00031c6b, 0x00031c77, 0x00031c9b,
+    0x00032033, 0x00032037, 0x00032043, 0x00032067, 0x00032b97, 0x00032b9b,
+    0x00032ba7, 0x00032bcb, 0x00032c37, 0x00033422, 0x00033425, 0x00033426,
+    0x00033427, 0x0003342b, 0x0003342f, 0x00033432, 0x00033433, 0x00033435,
+    0x0003343d, 0x00033441, 0x0003344d, 0x00033456, 0x00033457, 0x00033459,
+    0x0003345f, 0x00033473, 0x00033477, 0x00033483, 0x000334a7, 0x000334c3,
+    0x000334c5, 0x000334cb, 0x000334dd, 0x00033515, 0x00033519, 0x00033525,
+    0x00033549, 0x00033607, 0x00033609, 0x0003360f, 0x00033621, 0x000336fb,
+    0x000336ff, 0x0003370b, 0x0003372f, 0x000339d3, 0x000339d5, 0x000339db,
+    0x000339ed, 0x00033cad, 0x00033cb1, 0x00033cbd, 0x00033ce1, 0x00034537,
+    0x00034539, 0x0003453f, 0x00034551, 0x00036764, 0x00036767, 0x00036768,
+    0x00036769, 0x0003676d, 0x00036771, 0x00036774, 0x00036775, 0x00036777,
+    0x0003677f, 0x00036783, 0x0003678f, 0x00036798, 0x00036799, 0x0003679b,
+    0x000367a1, 0x000367b5, 0x000367b9, 0x000367c5, 0x000367e9, 0x00036805,
+    0x00036807, 0x0003680d, 0x0003681f, 0x00036857, 0x0003685b, 0x00036867,
+    0x0003688b, 0x00036949, 0x0003694b, 0x00036951, 0x00036963, 0x00036a3d,
+    0x00036a41, 0x00036a4d, 0x00036a71, 0x00036d15, 0x00036d17, 0x00036d1d,
+    0x00036d2f, 0x00036fef, 0x00036ff3, 0x00036fff, 0x00037023, 0x00037879,
+    0x0003787b, 0x00037881, 0x00037893, 0x00038104, 0x00038106, 0x00038107,
+    0x0003810c, 0x0003810d, 0x0003810f, 0x0003811e, 0x0003811f, 0x00038121,
+    0x00038127, 0x00038155, 0x00038157, 0x0003815d, 0x0003816f, 0x000381f7,
+    0x000381f9, 0x000381ff, 0x00038211, 0x000383dd, 0x000383e5, 0x000383f7,
+    0x0003898f, 0x00038991, 0x00038997, 0x0003cde8, 0x0003cdeb, 0x0003cdec,
+    0x0003cded, 0x0003cdf1, 0x0003cdf5, 0x0003cdf8, 0x0003cdf9, 0x0003cdfb,
+    0x0003ce03, 0x0003ce07, 0x0003ce13, 0x0003ce1c, 0x0003ce1d, 0x0003ce1f,
+    0x0003ce25, 0x0003ce39, 0x0003ce3d, 0x0003ce49, 0x0003ce6d, 0x0003ce89,
+    0x0003ce8b, 0x0003ce91, 0x0003cea3, 0x0003cedb, 0x0003cedf, 0x0003ceeb,
+    0x0003cf0f, 0x0003cfcd, 0x0003cfcf, 0x0003cfd5, 0x0003cfe7, 0x0003d0c1,
+    0x0003d0c5, 0x0003d0d1, 0x0003d0f5, 0x0003d399, 0x0003d39b, 0x0003d3a1,
+    0x0003d3b3, 0x0003d673, 0x0003d677, 0x0003d683, 0x0003d6a7, 0x0003defd,
+    0x0003deff, 0x0003df05, 0x0003df17, 0x00044e0d, 0x00044e11, 0x00044e1d,
+    0x00044e41, 0x000467ad, 0x000467af, 0x000467b5, 0x000467c7, 0x0004b490,
+    0x0004b492, 0x0004b493, 0x0004b498, 0x0004b499, 0x0004b49b, 0x0004b4aa,
+    0x0004b4ab, 0x0004b4ad, 0x0004b4b3, 0x0004b4e1, 0x0004b4e3, 0x0004b4e9,
+    0x0004b4fb, 0x0004b583, 0x0004b585, 0x0004b58b, 0x0004b59d, 0x0004b769,
+    0x0004b771, 0x0004b783, 0x0004bd1b, 0x0004bd1d, 0x0004bd23, 0x00050173,
+    0x00050175, 0x0005017b, 0x0005018d, 0x000534b5, 0x000534b7, 0x00059b3c,
+    0x00059b42, 0x00059b44, 0x00059b54, 0x00059b57, 0x00059b8a, 0x00059b8c,
+    0x00059b8d, 0x00059b92, 0x00059b93, 0x00059b95, 0x00059ba4, 0x00059ba5,
+    0x00059ba7, 0x00059bad, 0x00059c2c, 0x00059c2e, 0x00059c2f, 0x00059c34,
+    0x00059c35, 0x00059c37, 0x00059c46, 0x00059c47, 0x00059c49, 0x00059c4f,
+    0x00059c7d, 0x00059c7f, 0x00059c85, 0x00059c97, 0x00059e63, 0x00059e65,
+    0x00059e6b, 0x00059e7d, 0x00059f05, 0x00059f07, 0x0005a415, 0x0005a417,
+    0x0005e81c, 0x0005e81e, 0x0005e81f, 0x0005e824, 0x0005e825, 0x0005e827,
+    0x0005e836, 0x0005e837, 0x0005e839, 0x0005e83f, 0x0005e86d, 0x0005e86f,
+    0x0005e875, 0x0005e887, 0x0005e90f, 0x0005e917, 0x0005e929, 0x0005eaf5,
+    0x0005eaf7, 0x0005eafd, 0x0005f0a7, 0x0005f0a9, 0x0005f0af, 0x0005f0c1,
+    0x0006cec5, 0x0006cec7, 0x00081c0e, 0x00081c12, 0x00081c14, 0x00081c1d,
+    0x00081c1e, 0x00081c20, 0x00081c23, 0x00081c24, 0x00081c25, 0x00081c27,
+    0x00081c28, 0x00081c2a, 0x00081c2c, 0x00081c2e, 0x00081c30, 0x00081c32,
+    0x00081c35, 0x00081c36, 0x00081c37, 0x00081c3a, 0x00081c3c, 0x00081c3d,
+    0x00081c65, 0x00081c71, 0x00081c75, 0x00081c78, 0x00081c7a, 0x00081c7d,
+    0x00081c7e, 0x00081c7f, 0x00081c83, 0x00081c87, 0x00081c8a, 0x00081c8b,
+    0x00081c8d, 0x00081cb4, 0x00081cb5, 0x00081cb9, 0x00081cbd, 0x00081cc0,
+    0x00081cc1, 0x00081cc3, 0x00081cca, 0x00081ccc, 0x00081ccd, 0x00081cd2,
+    0x00081cd3, 0x00081cd5, 0x00081d07, 0x00081d13, 0x00081d17, 0x00081d1a,
+    0x00081d1c, 0x00081d1f, 0x00081d20, 0x00081d21, 0x00081d25, 0x00081d29,
+    0x00081d2c, 0x00081d2d, 0x00081d2f, 0x00081d6d, 0x00081d71, 0x00081d7d,
+    0x00081da7, 0x00081db3, 0x00081dbc, 0x00081dbd, 0x00081dbf, 0x00081dc5,
+    0x00081df2, 0x00081df4, 0x00081df7, 0x00081df8, 0x00081df9, 0x00081dfd,
+    0x00081e01, 0x00081e04, 0x00081e05, 0x00081e07, 0x00081e0e, 0x00081e10,
+    0x00081e11, 0x00081e16, 0x00081e17, 0x00081e19, 0x00081e49, 0x00081e55,
+    0x00081e5e, 0x00081e5f, 0x00081e61, 0x00081e67, 0x00081e9d, 0x00081eed,
+    0x00081ef9, 0x00081efd, 0x00081f00, 0x00081f02, 0x00081f05, 0x00081f06,
+    0x00081f07, 0x00081f0b, 0x00081f0f, 0x00081f12, 0x00081f13, 0x00081f15,
+    0x00081f53, 0x00081f57, 0x00081f63, 0x00081f89, 0x00081f8d, 0x00081f99,
+    0x00081fa2, 0x00081fa3, 0x00081fa5, 0x00081fab, 0x00081ff5, 0x00081ff9,
+    0x00082005, 0x00082095, 0x000820cd, 0x000820d1, 0x000820dd, 0x000820e6,
+    0x000820e7, 0x000820e9, 0x000820ef, 0x00082137, 0x0008216d, 0x000821be,
+    0x000821c0, 0x000821c3, 0x000821c4, 0x000821c5, 0x000821c9, 0x000821cd,
+    0x000821d0, 0x000821d1, 0x000821d3, 0x000821da, 0x000821dc, 0x000821dd,
+    0x000821e2, 0x000821e3, 0x000821e5, 0x00082211, 0x00082215, 0x00082221,
+    0x0008222a, 0x0008222b, 0x0008222d, 0x00082233, 0x00082260, 0x00082261,
+    0x00082263, 0x00082269, 0x000822b3, 0x000822b7, 0x000822c3, 0x000822cc,
+    0x000822cd, 0x000822cf, 0x000822d5, 0x0008231d, 0x00082353, 0x000823a4,
+    0x000823a5, 0x000823a7, 0x000823ad, 0x000823f5, 0x0008247e, 0x00082482,
+    0x00082484, 0x0008248d, 0x0008248e, 0x00082490, 0x00082493, 0x00082494,
+    0x00082495, 0x0008249f, 0x000824ab, 0x000824af, 0x000824b4, 0x000824b7,
+    0x000824b8, 0x000824b9, 0x000824bd, 0x000824c1, 0x000824c4, 0x000824c5,
+    0x000824c7, 0x000824d5, 0x000824e1, 0x000824e5, 0x00082505, 0x00082509,
+    0x00082515, 0x00082520, 0x00082523, 0x00082524, 0x00082525, 0x00082529,
+    0x0008252d, 0x00082530, 0x00082531, 0x00082533, 0x0008253b, 0x0008253f,
+    0x0008254b, 0x00082554, 0x00082555, 0x00082557, 0x0008255d, 0x00082577,
+    0x00082583, 0x00082587, 0x000825a7, 0x000825ab, 0x000825b7, 0x00082613,
+    0x00082617, 0x00082623, 0x00082647, 0x00082664, 0x00082667, 0x00082668,
+    0x00082669, 0x0008266d, 0x00082671, 0x00082674, 0x00082675, 0x00082677,
+    0x0008267f, 0x00082683, 0x0008268f, 0x00082698, 0x00082699, 0x0008269b,
+    0x000826a1, 0x000826b5, 0x000826b9, 0x000826c5, 0x000826e9, 0x00082705,
+    0x00082707, 0x0008270d, 0x0008271f, 0x0008275d, 0x00082769, 0x0008276d,
+    0x0008278d, 0x00082791, 0x0008279d, 0x000827f9, 0x000827fd, 0x00082809,
+    0x0008282d, 0x0008293d, 0x00082941, 0x0008294d, 0x00082971, 0x00082a30,
+    0x00082a33, 0x00082a34, 0x00082a35, 0x00082a39, 0x00082a3d, 0x00082a40,
+    0x00082a41, 0x00082a43, 0x00082a4b, 0x00082a4f, 0x00082a5b, 0x00082a65,
+    0x00082a67, 0x00082a6d, 0x00082a81, 0x00082a85, 0x00082a91, 0x00082ab5,
+    0x00082ad1, 0x00082ad3, 0x00082ad9, 0x00082aeb, 0x00082b23, 0x00082b27,
+    0x00082b33, 0x00082b57, 0x00082c15, 0x00082c17, 0x00082c1d, 0x00082c2f,
+    0x00082d08, 0x00082d0a, 0x00082d0c, 0x00082d0e, 0x00082d12, 0x00082d15,
+    0x00082d16, 0x00082d17, 0x00082d1a, 0x00082d1c, 0x00082d1d, 0x00082d24,
+    0x00082d27, 0x00082d28, 0x00082d29, 0x00082d2d, 0x00082d31, 0x00082d34,
+    0x00082d35, 0x00082d37, 0x00082d3e, 0x00082d40, 0x00082d41, 0x00082d47,
+    0x00082d49, 0x00082d5a, 0x00082d5d, 0x00082d5e, 0x00082d5f, 0x00082d63,
+    0x00082d67, 0x00082d6a, 0x00082d6b, 0x00082d6d, 0x00082d75, 0x00082d79,
+    0x00082d85, 0x00082d8e, 0x00082d8f, 0x00082d91, 0x00082d97, 0x00082daa,
+    0x00082dac, 0x00082dad, 0x00082db2, 0x00082db3, 0x00082db5, 0x00082dc4,
+    0x00082dc5, 0x00082dc7, 0x00082dcd, 0x00082dfc, 0x00082dff, 0x00082e00,
+    0x00082e01, 0x00082e05, 0x00082e09, 0x00082e0c, 0x00082e0d, 0x00082e0f,
+    0x00082e17, 0x00082e1b, 0x00082e27, 0x00082e30, 0x00082e31, 0x00082e33,
+    0x00082e39, 0x00082e4d, 0x00082e51, 0x00082e5d, 0x00082e81, 0x00082e9d,
+    0x00082e9f, 0x00082ea5, 0x00082eb7, 0x00082eee, 0x00082ef0, 0x00082ef1,
+    0x00082ef6, 0x00082ef7, 0x00082ef9, 0x00082f08, 0x00082f09, 0x00082f0b,
+    0x00082f11, 0x00082f3f, 0x00082f41, 0x00082f47, 0x00082f59, 0x00082fe2,
+    0x00082fe5, 0x00082fe6, 0x00082fe7, 0x00082feb, 0x00082fef, 0x00082ff2,
+    0x00082ff3, 0x00082ff5, 0x00082ffd, 0x00083001, 0x0008300d, 0x00083017,
+    0x00083019, 0x00083033, 0x00083037, 0x00083043, 0x00083067, 0x00083083,
+    0x00083085, 0x0008308b, 0x0008309d, 0x000830d5, 0x000830d9, 0x000830e5,
+    0x00083109, 0x000831c7, 0x000831c9, 0x000831cf, 0x000831e1, 0x000832ba,
+    0x000832bc, 0x000832bd, 0x000832c3, 0x000832c5, 0x000832d5, 0x000832d7,
+    0x0008330b, 0x0008330d, 0x00083313, 0x00083325, 0x000833ad, 0x000833af,
+    0x000833b5, 0x000833c7, 0x000835c1, 0x000835c5, 0x000835c8, 0x000835ca,
+    0x000835cd, 0x000835ce, 0x000835cf, 0x000835d3, 0x000835d7, 0x000835da,
+    0x000835db, 0x000835dd, 0x00083661, 0x0008366a, 0x0008366b, 0x0008366d,
+    0x00083673, 0x000836bd, 0x000836c1, 0x000836cd, 0x0008375d, 0x000837a5,
+    0x000837ae, 0x000837af, 0x000837b1, 0x000837b7, 0x000838a3, 0x000838a7,
+    0x000838b3, 0x00083943, 0x00083a87, 0x00083b61, 0x00083b65, 0x00083b71,
+    0x00083b7a, 0x00083b7b, 0x00083b7d, 0x00083b83, 0x00083c01, 0x00083c6d,
+    0x00083d45, 0x00083e25, 0x00083e31, 0x00083e35, 0x00083e55, 0x00083e59,
+    0x00083e65, 0x00083ec1, 0x00083ec5, 0x00083ed1, 0x00083ef5, 0x00084005,
+    0x00084009, 0x00084015, 0x00084039, 0x000843d1, 0x000843d5, 0x000843e1,
+    0x00084405, 0x000846aa, 0x000846ad, 0x000846ae, 0x000846af, 0x000846b3,
+    0x000846b7, 0x000846ba, 0x000846bb, 0x000846bd, 0x000846c5, 0x000846c9,
+    0x000846d5, 0x000846de, 0x000846df, 0x000846e1, 0x000846e7, 0x0008474b,
+    0x0008474d, 0x00084753, 0x00084765, 0x0008479d, 0x000847a1, 0x000847ad,
+    0x000847d1, 0x0008488f, 0x00084891, 0x00084897, 0x000848a9, 0x00084983,
+    0x00084987, 0x00084993, 0x000849b7, 0x00084c5b, 0x00084c5d, 0x00084c63,
+    0x00084c75, 0x00084f60, 0x00084f61, 0x00084f63, 0x00084f6a, 0x00084f6c,
+    0x00084f6d, 0x00084f72, 0x00084f73, 0x00084f75, 0x00084fba, 0x00084fbb,
+    0x00084fbd, 0x00084fc3, 0x00085053, 0x0008505c, 0x0008505d, 0x0008505f,
+    0x00085065, 0x000850ad, 0x00085229, 0x0008522d, 0x00085239, 0x00085242,
+    0x00085243, 0x00085245, 0x0008524b, 0x00085293, 0x000852c9, 0x00085335,
+    0x0008540d, 0x00085500, 0x00085501, 0x00085503, 0x00085509, 0x00085551,
+    0x000855f3, 0x000857c0, 0x000857c3, 0x000857c4, 0x000857c5, 0x000857c9,
+    0x000857cd, 0x000857d0, 0x000857d1, 0x000857d3, 0x000857db, 0x000857df,
+    0x000857eb, 0x000857f4, 0x000857f5, 0x000857f7, 0x000857fd, 0x00085811,
+    0x00085815, 0x00085821, 0x00085845, 0x00085861, 0x00085863, 0x00085869,
+    0x0008587b, 0x000858b3, 0x000858b7, 0x000858c3, 0x000858e7, 0x000859a5,
+    0x000859a7, 0x000859ad, 0x000859bf, 0x00085a99, 0x00085a9d, 0x00085aa9,
+    0x00085acd, 0x00085d71, 0x00085d73, 0x00085d79, 0x00085d8b, 0x0008604a,
+    0x0008604c, 0x0008604d, 0x00086052, 0x00086053, 0x00086055, 0x00086064,
+    0x00086065, 0x00086067, 0x0008606d, 0x0008609b, 0x0008609d, 0x000860a3,
+    0x000860b5, 0x0008613d, 0x0008613f, 0x00086145, 0x00086157, 0x00086323,
+    0x00086325, 0x0008632b, 0x0008633d, 0x0008690a, 0x0008690c, 0x0008690f,
+    0x00086910, 0x00086911, 0x00086915, 0x00086919, 0x0008691c, 0x0008691d,
+    0x0008691f, 0x0008695d, 0x00086961, 0x0008696d, 0x000869ac, 0x000869ad,
+    0x000869af, 0x000869b5, 0x000869ff, 0x00086a03, 0x00086a0f, 0x00086a9f,
+    0x00086af0, 0x00086af1, 0x00086af3, 0x00086af9, 0x00086b41, 0x00086ea3,
+    0x00086ea7, 0x00086eb3, 0x00086ebc, 0x00086ebd, 0x00086ebf, 0x00086ec5,
+    0x00086f0d, 0x00086f43, 0x00086faf, 0x00087087, 0x00087167, 0x00087173,
+    0x00087177, 0x00087197, 0x0008719b, 0x000871a7, 0x00087203, 0x00087207,
+    0x00087213, 0x00087237, 0x00087347, 0x0008734b, 0x00087357, 0x0008737b,
+    0x00087713, 0x00087717, 0x00087723, 0x000879ec, 0x000879ef, 0x000879f0,
+    0x000879f1, 0x000879f5, 0x000879f9, 0x000879fc, 0x000879fd, 0x000879ff,
+    0x00087a07, 0x00087a0b, 0x00087a17, 0x00087a21, 0x00087a23, 0x00087a3d,
+    0x00087a41, 0x00087a4d, 0x00087a71, 0x00087a8d, 0x00087a8f, 0x00087a95,
+    0x00087aa7, 0x00087adf, 0x00087ae3, 0x00087aef, 0x00087b13, 0x00087bd1,
+    0x00087bd3, 0x00087bd9, 0x00087beb, 0x00087f9d, 0x00087f9f, 0x000882ad,
+    0x000882b1, 0x000882bd, 0x0008834d, 0x00088491, 0x0008885d, 0x0008938d,
+    0x00089391, 0x0008939d, 0x000893c1, 0x00089c4c, 0x00089c4d, 0x00089c4f,
+    0x00089c55, 0x00089c9d, 0x00089d3f, 0x0008a1e3, 0x0008a4a3, 0x0008a4a7,
+    0x0008a4b3, 0x0008a4d7, 0x0008ad2d, 0x0008ad2f, 0x0008ad35, 0x0008b5ee,
+    0x0008b5f0, 0x0008b5f1, 0x0008b5f6, 0x0008b5f7, 0x0008b5f9, 0x0008b63e,
+    0x0008b63f, 0x0008b641, 0x0008b647, 0x0008b6e0, 0x0008b6e1, 0x0008b6e3,
+    0x0008b6e9, 0x0008b731, 0x0008b8c6, 0x0008b8c7, 0x0008b8c9, 0x0008b8cf,
+    0x0008b917, 0x0008b9b9, 0x0008bb84, 0x0008bb85, 0x0008bb87, 0x0008bb8d,
+    0x0008bc77, 0x0008be44, 0x0008be47, 0x0008be48, 0x0008be49, 0x0008be4d,
+    0x0008be51, 0x0008be54, 0x0008be55, 0x0008be57, 0x0008be5f, 0x0008be63,
+    0x0008be6f, 0x0008be79, 0x0008be7b, 0x0008be81, 0x0008be95, 0x0008be99,
+    0x0008bea5, 0x0008bec9, 0x0008bee5, 0x0008bee7, 0x0008beed, 0x0008beff,
+    0x0008bf37, 0x0008bf3b, 0x0008bf47, 0x0008bf6b, 0x0008c029, 0x0008c02b,
+    0x0008c031, 0x0008c043, 0x0008c11d, 0x0008c121, 0x0008c12d, 0x0008c3f5,
+    0x0008c3f7, 0x0008c3fd, 0x0008c6ce, 0x0008c6d0, 0x0008c6d1, 0x0008c6d7,
+    0x0008c6d9, 0x0008c6e9, 0x0008c6eb, 0x0008c71f, 0x0008c721, 0x0008c727,
+    0x0008c739, 0x0008c7c1, 0x0008c7c3, 0x0008c7c9, 0x0008c7db, 0x0008c9a7,
+    0x0008c9a9, 0x0008cf8e, 0x0008cf8f, 0x0008cf91, 0x0008cf97, 0x0008d081,
+    0x0008d267, 0x0008d7e5, 0x0008d7e9, 0x0008d7f5, 0x0008d819, 0x0008e06f,
+    0x0008e071, 0x0008e077, 0x0008f185, 0x0008f187, 0x0008f18d, 0x000902bd,
+    0x000902c9, 0x000902cd, 0x000902d2, 0x000902d5, 0x000902d6, 0x000902d7,
+    0x000902db, 0x000902df, 0x000902e3, 0x000902e5, 0x00090323, 0x00090327,
+    0x00090333, 0x0009035d, 0x00090369, 0x00090372, 0x00090373, 0x00090375,
+    0x0009037b, 0x000903c5, 0x000903c9, 0x000903d5, 0x00090465, 0x0009049d,
+    0x000904a1, 0x000904ad, 0x000904b6, 0x000904b7, 0x000904b9, 0x000904bf,
+    0x00090507, 0x000905ab, 0x000905af, 0x0009064b, 0x0009078f, 0x00090869,
+    0x0009086d, 0x00090883, 0x00090885, 0x000908d3, 0x00090909, 0x00090975,
+    0x00090a4d, 0x00090b2d, 0x00090b39, 0x00090b3d, 0x00090b5d, 0x00090b61,
+    0x00090bc9, 0x00090bcd, 0x00090bd9, 0x00090bfd, 0x00090d0d, 0x00090d11,
+    0x00090d1d, 0x00090d41, 0x000910d9, 0x000910dd, 0x000913b2, 0x000913b5,
+    0x000913b6, 0x000913b7, 0x000913bb, 0x000913bf, 0x000913c3, 0x000913c5,
+    0x000913cd, 0x000913d1, 0x000913e7, 0x000913e9, 0x00091403, 0x00091407,
+    0x00091413, 0x00091437, 0x00091453, 0x00091455, 0x0009145b, 0x0009146d,
+    0x000914a5, 0x000914a9, 0x000914b5, 0x00091597, 0x00091599, 0x0009159f,
+    0x000915b1, 0x0009168b, 0x0009168f, 0x00091963, 0x00091965, 0x00091c73,
+    0x00091c77, 0x00091c83, 0x00091d13, 0x00091e57, 0x00092223, 0x00092d53,
+    0x00092d57, 0x00092d63, 0x00092d87, 0x00093609, 0x00093612, 0x00093613,
+    0x00093615, 0x0009361b, 0x00093663, 0x00093705, 0x000938eb, 0x00093e69,
+    0x00093e6d, 0x00093e79, 0x00093e9d, 0x000946f3, 0x000946f5, 0x000946fb,
+    0x00094fb5, 0x00094fb9, 0x00095055, 0x00095199, 0x00096095, 0x00096099,
+    0x000982f5, 0x00099c97, 0x00099c99, 0x00099ce7, 0x00099d89, 0x0009a4ed,
+    0x0009a4f1, 0x0009ad77, 0x0009ad79, 0x0009b637, 0x0009e960, 0x0009e963,
+    0x0009e964, 0x0009e965, 0x0009e969, 0x0009e96d, 0x0009e971, 0x0009e973,
+    0x0009e97a, 0x0009e97c, 0x0009e97d, 0x0009e983, 0x0009e985, 0x0009e9b5,
+    0x0009e9c1, 0x0009e9ca, 0x0009e9cb, 0x0009e9cd, 0x0009e9d3, 0x0009ea09,
+    0x0009ea53, 0x0009ea57, 0x0009ea6d, 0x0009ea6f, 0x0009eabd, 0x0009eb44,
+    0x0009eb45, 0x0009eb47, 0x0009eb4d, 0x0009ec39, 0x0009ec3d, 0x0009ec53,
+    0x0009ec55, 0x0009eca3, 0x0009ecd9, 0x0009ee1d, 0x0009ef11, 0x0009ef13,
+    0x0009ef61, 0x0009f1d0, 0x0009f1d3, 0x0009f1d4, 0x0009f1d5, 0x0009f1d9,
+    0x0009f1dd, 0x0009f1e1, 0x0009f1e3, 0x0009f1eb, 0x0009f1ef, 0x0009f205,
+    0x0009f207, 0x0009f221, 0x0009f225, 0x0009f231, 0x0009f255, 0x0009f271,
+    0x0009f273, 0x0009f279, 0x0009f28b, 0x0009f2c3, 0x0009f2c7, 0x0009f3b5,
+    0x0009f3b7, 0x0009f3bd, 0x0009f4a9, 0x0009f4ad, 0x0009f781, 0x0009f783,
+    0x0009fa5a, 0x0009fa5c, 0x0009fa5d, 0x0009fa63, 0x0009fa65, 0x0009fa75,
+    0x0009fa77, 0x0009faab, 0x0009faad, 0x0009fab3, 0x0009fac5, 0x0009fb4d,
+    0x0009fb4f, 0x0009fd33, 0x0009fd35, 0x000a0311, 0x000a031a, 0x000a031b,
+    0x000a031d, 0x000a0323, 0x000a040d, 0x000a05f3, 0x000a0b71, 0x000a0b75,
+    0x000a0b81, 0x000a0ba5, 0x000a13fb, 0x000a13fd, 0x000a1403, 0x000a2511,
+    0x000a2513, 0x000a2519, 0x000a365d, 0x000a365f, 0x000a36ad, 0x000a3eb3,
+    0x000a3eb7, 0x000a473d, 0x000a473f, 0x000a4ffd, 0x000a8b95, 0x000a8b97,
+    0x000acfee, 0x000acff2, 0x000acff4, 0x000acffd, 0x000ad000, 0x000ad003,
+    0x000ad004, 0x000ad005, 0x000ad00f, 0x000ad01b, 0x000ad01f, 0x000ad024,
+    0x000ad027, 0x000ad028, 0x000ad029, 0x000ad02d, 0x000ad031, 0x000ad035,
+    0x000ad037, 0x000ad045, 0x000ad051, 0x000ad055, 0x000ad075, 0x000ad079,
+    0x000ad085, 0x000ad090, 0x000ad093, 0x000ad094, 0x000ad095, 0x000ad099,
+    0x000ad09d, 0x000ad0a0, 0x000ad0a1, 0x000ad0a3, 0x000ad0ab, 0x000ad0af,
+    0x000ad0bb, 0x000ad0c4, 0x000ad0c5, 0x000ad0c7, 0x000ad0cd, 0x000ad0e7,
+    0x000ad0f3, 0x000ad0f7, 0x000ad117, 0x000ad11b, 0x000ad183, 0x000ad187,
+    0x000ad193, 0x000ad1b7, 0x000ad1d4, 0x000ad1d7, 0x000ad1d8, 0x000ad1d9,
+    0x000ad1dd, 0x000ad1e1, 0x000ad1e5, 0x000ad1e7, 0x000ad1ef, 0x000ad1f3,
+    0x000ad209, 0x000ad20b, 0x000ad225, 0x000ad229, 0x000ad235, 0x000ad259,
+    0x000ad277, 0x000ad27d, 0x000ad28f, 0x000ad2cd, 0x000ad2d9, 0x000ad2dd,
+    0x000ad2fd, 0x000ad301, 0x000ad369, 0x000ad36d, 0x000ad379, 0x000ad39d,
+    0x000ad4ad, 0x000ad4b1, 0x000ad5a0, 0x000ad5a3, 0x000ad5a4, 0x000ad5a5,
+    0x000ad5a9, 0x000ad5ad, 0x000ad5b1, 0x000ad5b3, 0x000ad5bb, 0x000ad5bf,
+    0x000ad5d5, 0x000ad5d7, 0x000ad5f1, 0x000ad5f5, 0x000ad601, 0x000ad625,
+    0x000ad643, 0x000ad649, 0x000ad65b, 0x000ad693, 0x000ad697, 0x000ad787,
+    0x000ad87f, 0x000ad88b, 0x000ad88f, 0x000ad8af, 0x000ad8b3, 0x000ad91b,
+    0x000ad91f, 0x000ad92b, 0x000ad94f, 0x000ada5f, 0x000ada63, 0x000ade2b,
+    0x000ade2f, 0x000ae104, 0x000ae107, 0x000ae108, 0x000ae109, 0x000ae10d,
+    0x000ae111, 0x000ae115, 0x000ae117, 0x000ae11f, 0x000ae123, 0x000ae139,
+    0x000ae155, 0x000ae159, 0x000ae165, 0x000ae189, 0x000ae1a5, 0x000ae1a7,
+    0x000ae1ad, 0x000ae1bf, 0x000ae1f7, 0x000ae1fb, 0x000ae2e9, 0x000ae2eb,
+    0x000ae3dd, 0x000ae3e1, 0x000ae6b5, 0x000ae995, 0x000ae9a1, 0x000ae9a5,
+    0x000ae9c5, 0x000ae9c9, 0x000ae9d5, 0x000aea31, 0x000aea35, 0x000aea41,
+    0x000aea65, 0x000aeb75, 0x000aeb79, 0x000aeb85, 0x000aeba9, 0x000aef41,
+    0x000aef45, 0x000aef51, 0x000aef75, 0x000afaa5, 0x000afaa9, 0x000afab5,
+    0x000afad9, 0x000b0330, 0x000b0333, 0x000b0334, 0x000b0335, 0x000b0339,
+    0x000b033d, 0x000b0340, 0x000b0341, 0x000b0343, 0x000b034b, 0x000b034f,
+    0x000b035b, 0x000b0364, 0x000b0365, 0x000b0367, 0x000b036d, 0x000b0381,
+    0x000b0385, 0x000b0391, 0x000b03b5, 0x000b03d3, 0x000b03d9, 0x000b03eb,
+    0x000b0423, 0x000b0427, 0x000b0433, 0x000b0457, 0x000b0517, 0x000b051d,
+    0x000b0609, 0x000b060d, 0x000b0619, 0x000b063d, 0x000b08e3, 0x000b08e9,
+    0x000b0bbb, 0x000b0bbf, 0x000b0bcb, 0x000b0bef, 0x000b1445, 0x000b1447,
+    0x000b144d, 0x000b1cd7, 0x000b1ce3, 0x000b1ce7, 0x000b1d07, 0x000b1d0b,
+    0x000b1d73, 0x000b1d77, 0x000b1d83, 0x000b1da7, 0x000b1eb7, 0x000b1ebb,
+    0x000b2283, 0x000b2287, 0x000b2de7, 0x000b2deb, 0x000b5013, 0x000b5017,
+    0x000b5023, 0x000b5047, 0x000b69b4, 0x000b69b7, 0x000b69b8, 0x000b69b9,
+    0x000b69bd, 0x000b69c1, 0x000b69c5, 0x000b69c7, 0x000b69cf, 0x000b69d3,
+    0x000b69e9, 0x000b69eb, 0x000b6a05, 0x000b6a09, 0x000b6a15, 0x000b6a39,
+    0x000b6a57, 0x000b6a5d, 0x000b6a6f, 0x000b6aa7, 0x000b6aab, 0x000b6b9b,
+    0x000b6c8d, 0x000b6c91, 0x000b6f67, 0x000b723f, 0x000b7243, 0x000b7ac9,
+    0x000b8355, 0x000b8359, 0x000b8365, 0x000b8389, 0x000b9cf7, 0x000b9cfd,
+    0x000bb69d, 0x000bb6a9, 0x000bb6ad, 0x000bb6cd, 0x000bb6d1, 0x000bb739,
+    0x000bb73d, 0x000bb749, 0x000bb76d, 0x000bb87d, 0x000bb881, 0x000bbc49,
+    0x000bbc4d, 0x000bc7ad, 0x000bc7b1, 0x000be9d9, 0x000be9dd, 0x000be9e9,
+    0x000bea0d, 0x000c505d, 0x000c5061, 0x000c9d40, 0x000c9d43, 0x000c9d44,
+    0x000c9d45, 0x000c9d49, 0x000c9d4d, 0x000c9d51, 0x000c9d5b, 0x000c9d5f,
+    0x000c9d75, 0x000c9d91, 0x000c9d95, 0x000c9da1, 0x000c9dc5, 0x000c9de3,
+    0x000c9de9, 0x000c9dfb, 0x000c9e33, 0x000c9e37, 0x000c9f27, 0x000ca019,
+    0x000ca01d, 0x000ca5cb, 0x000ca5cf, 0x000cae55, 0x000cb6e1, 0x000cb6e5,
+    0x000cb6f1, 0x000cb715, 0x000cd083, 0x000cd089, 0x000cea23, 0x000cea27,
+    0x000d83ec, 0x000d83ee, 0x000d83f2, 0x000d83f5, 0x000d83f6, 0x000d83f7,
+    0x000d83fa, 0x000d83fd, 0x000d8404, 0x000d8407, 0x000d8408, 0x000d8409,
+    0x000d840d, 0x000d8411, 0x000d8415, 0x000d841e, 0x000d8421, 0x000d8427,
+    0x000d843a, 0x000d843d, 0x000d843e, 0x000d843f, 0x000d8443, 0x000d8447,
+    0x000d844a, 0x000d844b, 0x000d844d, 0x000d8455, 0x000d8459, 0x000d8465,
+    0x000d846e, 0x000d846f, 0x000d8471, 0x000d8477, 0x000d848c, 0x000d848d,
+    0x000d8492, 0x000d8493, 0x000d8495, 0x000d84a4, 0x000d84a5, 0x000d84a7,
+    0x000d84ad, 0x000d84dc, 0x000d84df, 0x000d84e0, 0x000d84e1, 0x000d84e5,
+    0x000d84e9, 0x000d84ed, 0x000d84f7, 0x000d84fb, 0x000d8511, 0x000d852d,
+    0x000d8531, 0x000d853d, 0x000d8561, 0x000d857f, 0x000d8585, 0x000d8597,
+    0x000d85d1, 0x000d85d7, 0x000d85e9, 0x000d8621, 0x000d8627, 0x000d86c2,
+    0x000d86c5, 0x000d86c6, 0x000d86c7, 0x000d86cb, 0x000d86cf, 0x000d86d3,
+    0x000d86dd, 0x000d86e1, 0x000d86f7, 0x000d8713, 0x000d8717, 0x000d8723,
+    0x000d8747, 0x000d8765, 0x000d876b, 0x000d877d, 0x000d87b5, 0x000d87b9,
+    0x000d899d, 0x000d89a3, 0x000d89b5, 0x000d89ed, 0x000d89f3, 0x000d8c74,
+    0x000d8c77, 0x000d8c79, 0x000d8c7d, 0x000d8c81, 0x000d8c85, 0x000d8c8f,
+    0x000d8ca9, 0x000d8cc5, 0x000d8cc9, 0x000d8cd5, 0x000d8cf9, 0x000d8d17,
+    0x000d8d1d, 0x000d8d2f, 0x000d8d67, 0x000d8d6b, 0x000d8f4d, 0x000d94fe,
+    0x000d9501, 0x000d9507, 0x000d9519, 0x000d954f, 0x000d9551, 0x000d9557,
+    0x000d95f1, 0x000d97d7, 0x000d9d8a, 0x000d9d8d, 0x000d9d8e, 0x000d9d8f,
+    0x000d9d93, 0x000d9d97, 0x000d9d9a, 0x000d9d9b, 0x000d9d9d, 0x000d9da5,
+    0x000d9da9, 0x000d9db5, 0x000d9dbe, 0x000d9dbf, 0x000d9dc1, 0x000d9dc7,
+    0x000d9e2d, 0x000d9e33, 0x000d9e7d, 0x000d9e81, 0x000d9e8d, 0x000d9eb1,
+    0x000d9f71, 0x000d9f77, 0x000da063, 0x000da067, 0x000da073, 0x000da097,
+    0x000da33d, 0x000da343, 0x000da615, 0x000da619, 0x000da625, 0x000da649,
+    0x000daea1, 0x000daea7, 0x000db72c, 0x000db72d, 0x000db732, 0x000db733,
+    0x000db735, 0x000db745, 0x000db747, 0x000db74d, 0x000db77d, 0x000db783,
+    0x000db81f, 0x000db825, 0x000dba05, 0x000dba0b, 0x000dbfb7, 0x000dbfbd,
+    0x000dd0cc, 0x000dd0cf, 0x000dd0d0, 0x000dd0d1, 0x000dd0d5, 0x000dd0d9,
+    0x000dd0dd, 0x000dd0e7, 0x000dd0eb, 0x000dd101, 0x000dd11d, 0x000dd121,
+    0x000dd12d, 0x000dd151, 0x000dd16f, 0x000dd175, 0x000dd1bf, 0x000dd1c3,
+    0x000dd957, 0x000dea6d, 0x000dea71, 0x000dea7d, 0x000deaa1, 0x000e040f,
+    0x000e0415, 0x000e1db1, 0x000e1db7, 0x000e1dc9, 0x000e1e01, 0x000e1e07,
+    0x000e3751, 0x000e3757, 0x000e6a92, 0x000e6a95, 0x000e6a97, 0x000e6a9b,
+    0x000e6aa3, 0x000e6aad, 0x000e6ac7, 0x000e6ae3, 0x000e6ae7, 0x000e6af3,
+    0x000e6b17, 0x000e6b35, 0x000e6b3b, 0x000e6b85, 0x000e6b89, 0x000e6d6b,
+    0x000e731d, 0x000e8433, 0x000e8437, 0x000e8443, 0x000e8467, 0x000e9dd5,
+    0x000e9ddb, 0x000eb775, 0x000f513d, 0x000f5143, 0x000f5155, 0x000f518d,
+    0x000f5193, 0x000f6add, 0x000f6ae3, 0x0010381c, 0x00103822, 0x00103824,
+    0x0010386c, 0x0010386d, 0x00103872, 0x00103873, 0x00103875, 0x0010390c,
+    0x0010390e, 0x0010390f, 0x00103914, 0x00103915, 0x00103917, 0x0010395f,
+    0x00103965, 0x00103af2, 0x00103af4, 0x00103af5, 0x00103afa, 0x00103afb,
+    0x00103afd, 0x00103b42, 0x00103b43, 0x00103b45, 0x00103b4b, 0x00103be4,
+    0x00103be5, 0x00103be7, 0x00103bed, 0x00104070, 0x00104072, 0x00104074,
+    0x00104076, 0x00104078, 0x0010407b, 0x0010407c, 0x0010407d, 0x00104080,
+    0x00104082, 0x00104083, 0x0010408a, 0x0010408d, 0x0010408e, 0x0010408f,
+    0x00104093, 0x00104097, 0x0010409a, 0x0010409b, 0x0010409d, 0x001040a4,
+    0x001040a6, 0x001040a7, 0x001040ac, 0x001040ad, 0x001040af, 0x001040c0,
+    0x001040c3, 0x001040c4, 0x001040c5, 0x001040c9, 0x001040cd, 0x001040d0,
+    0x001040d1, 0x001040d3, 0x001040db, 0x001040df, 0x001040eb, 0x001040f4,
+    0x001040f5, 0x001040f7, 0x001040fd, 0x00104112, 0x00104113, 0x00104118,
+    0x00104119, 0x0010411b, 0x0010412b, 0x0010412d, 0x00104133, 0x00104162,
+    0x00104165, 0x00104166, 0x00104167, 0x0010416b, 0x0010416f, 0x00104172,
+    0x00104173, 0x00104175, 0x0010417d, 0x00104181, 0x0010418d, 0x00104196,
+    0x00104197, 0x00104199, 0x0010419f, 0x001041b3, 0x001041b7, 0x001041c3,
+    0x001041e7, 0x00104205, 0x0010420b, 0x00104256, 0x00104257, 0x0010425c,
+    0x0010425d, 0x0010425f, 0x0010426f, 0x00104271, 0x00104277, 0x001042a7,
+    0x001042ad, 0x00104348, 0x0010434b, 0x0010434c, 0x0010434d, 0x00104351,
+    0x00104355, 0x00104358, 0x00104359, 0x0010435b, 0x00104363, 0x00104367,
+    0x00104373, 0x0010437d, 0x0010437f, 0x00104385, 0x00104399, 0x0010439d,
+    0x001043a9, 0x001043cd, 0x001043eb, 0x001043f1, 0x0010452f, 0x00104535,
+    0x00104622, 0x00104623, 0x00104628, 0x00104629, 0x0010462b, 0x0010463b,
+    0x0010463d, 0x00104643, 0x00104673, 0x00104679, 0x00104715, 0x0010471b,
+    0x001048fc, 0x00104902, 0x00104904, 0x00104914, 0x00104916, 0x00104917,
+    0x0010491d, 0x0010494c, 0x0010494d, 0x00104952, 0x00104953, 0x00104955,
+    0x00104965, 0x00104967, 0x0010496d, 0x001049ee, 0x001049ef, 0x001049f4,
+    0x001049f5, 0x001049f7, 0x00104a07, 0x00104a09, 0x00104a0f, 0x00104a3f,
+    0x00104a45, 0x00104bd4, 0x00104bd5, 0x00104bdb, 0x00104bdd, 0x00104bed,
+    0x00104bef, 0x00104c25, 0x00104c2b, 0x00104cc7, 0x00104ccd, 0x001051c2,
+    0x001051c3, 0x001051c5, 0x00105492, 0x00105493, 0x00105495, 0x0010549b,
+    0x001054e3, 0x00105585, 0x00105a10, 0x00105a13, 0x00105a14, 0x00105a15,
+    0x00105a19, 0x00105a1d, 0x00105a20, 0x00105a21, 0x00105a23, 0x00105a2b,
+    0x00105a2f, 0x00105a3b, 0x00105a44, 0x00105a45, 0x00105a47, 0x00105a4d,
+    0x00105a61, 0x00105a65, 0x00105a71, 0x00105a95, 0x00105ab3, 0x00105ab9,
+    0x00105b03, 0x00105b07, 0x00105b13, 0x00105b37, 0x00105bf7, 0x00105bfd,
+    0x00105ce9, 0x00105ced, 0x00105cf9, 0x00105d1d, 0x00105fc3, 0x00105fc9,
+    0x0010629c, 0x0010629d, 0x001062a2, 0x001062a3, 0x001062a5, 0x001062b5,
+    0x001062b7, 0x001062bd, 0x001062ed, 0x001062f3, 0x0010638f, 0x00106575,
+    0x0010657b, 0x001073b2, 0x001073b3, 0x001073b8, 0x001073b9, 0x001073bb,
+    0x001073cb, 0x001073cd, 0x001073d3, 0x00107403, 0x00107409, 0x001074a5,
+    0x001074ab, 0x0010768b, 0x00107691, 0x001087d4, 0x001087d5, 0x001087d7,
+    0x001087dd, 0x001088c7, 0x00108d52, 0x00108d55, 0x00108d56, 0x00108d57,
+    0x00108d5b, 0x00108d5f, 0x00108d62, 0x00108d63, 0x00108d65, 0x00108d6d,
+    0x00108d71, 0x00108d7d, 0x00108d87, 0x00108d89, 0x00108d8f, 0x00108da3,
+    0x00108da7, 0x00108db3, 0x00108dd7, 0x00108df5, 0x00108dfb, 0x00108e45,
+    0x00108e49, 0x00108e55, 0x00108e79, 0x00108f39, 0x00108f3f, 0x0010902b,
+    0x0010902f, 0x0010903b, 0x00109305, 0x0010930b, 0x001095de, 0x001095df,
+    0x001095e5, 0x001095e7, 0x001095f7, 0x001095f9, 0x0010962f, 0x00109635,
+    0x001096d7, 0x001098b7, 0x0010a6f3, 0x0010a6f7, 0x0010a703, 0x0010af7f,
+    0x0010af85, 0x0010c095, 0x0010c09b, 0x0010da36, 0x0010da37, 0x0010da3c,
+    0x0010da3d, 0x0010da3f, 0x0010da4f, 0x0010da51, 0x0010da57, 0x0010da87,
+    0x0010da8d, 0x0010db29, 0x0010db2f, 0x0010dd0f, 0x0010dd15, 0x0010f3d7,
+    0x0010f3dd, 0x00111ec2, 0x00111ec4, 0x00111ec5, 0x00111ecb, 0x00111ecd,
+    0x00111f15, 0x00111f1b, 0x00111fb4, 0x00111fb7, 0x00111fbd, 0x0011219b,
+    0x0011219d, 0x001121eb, 0x0011228d, 0x00112718, 0x0011271b, 0x0011271c,
+    0x0011271d, 0x00112721, 0x00112725, 0x00112729, 0x0011272b, 0x00112733,
+    0x00112737, 0x0011274d, 0x0011274f, 0x00112769, 0x0011276d, 0x00112779,
+    0x0011279d, 0x001127bb, 0x001127c1, 0x0011280b, 0x0011280f, 0x0011281b,
+    0x001128ff, 0x00112905, 0x001129f1, 0x001129f5, 0x00112ccb, 0x00112fa4,
+    0x00112fa5, 0x00112fab, 0x00112fad, 0x00112fbd, 0x00112fbf, 0x00112ff5,
+    0x00112ffb, 0x00113097, 0x0011327d, 0x0011386b, 0x001140b9, 0x001140bd,
+    0x001140c9, 0x00114945, 0x0011494b, 0x00115a5b, 0x00115a61, 0x001173fb,
+    0x001173ff, 0x00117c87, 0x0011c0df, 0x00120dc2, 0x00120dc3, 0x00120dc9,
+    0x00120dcb, 0x00120ddb, 0x00120ddd, 0x00120e13, 0x00120e19, 0x00120eb5,
+    0x0012109b, 0x00122763, 0x00122769, 0x00125aa5, 0x0012ebe0, 0x0012ebe2,
+    0x0012ebe4, 0x0012ebe8, 0x0012ebeb, 0x0012ebec, 0x0012ebed, 0x0012ebf0,
+    0x0012ebf2, 0x0012ebf3, 0x0012ebfa, 0x0012ebfd, 0x0012ebfe, 0x0012ebff,
+    0x0012ec03, 0x0012ec07, 0x0012ec0b, 0x0012ec0d, 0x0012ec14, 0x0012ec16,
+    0x0012ec17, 0x0012ec1d, 0x0012ec1f, 0x0012ec33, 0x0012ec34, 0x0012ec35,
+    0x0012ec39, 0x0012ec3d, 0x0012ec40, 0x0012ec41, 0x0012ec43, 0x0012ec4b,
+    0x0012ec4f, 0x0012ec5b, 0x0012ec64, 0x0012ec65, 0x0012ec67, 0x0012ec6d,
+    0x0012ec82, 0x0012ec83, 0x0012ec88, 0x0012ec89, 0x0012ec8b, 0x0012ec9b,
+    0x0012ec9d, 0x0012eca3, 0x0012ecd5, 0x0012ecd6, 0x0012ecd7, 0x0012ecdb,
+    0x0012ecdf, 0x0012ece3, 0x0012ece5, 0x0012eced, 0x0012ecf1, 0x0012ed07,
+    0x0012ed09, 0x0012ed27, 0x0012ed33, 0x0012ed57, 0x0012ed75, 0x0012ed7b,
+    0x0012edc6, 0x0012edc7, 0x0012edcd, 0x0012edcf, 0x0012eddf, 0x0012ede1,
+    0x0012ee17, 0x0012ee1d, 0x0012eebc, 0x0012eebd, 0x0012eec1, 0x0012eec5,
+    0x0012eec9, 0x0012eed3, 0x0012eed7, 0x0012eeed, 0x0012ef0d, 0x0012ef19,
+    0x0012ef3d, 0x0012ef61, 0x0012efaf, 0x0012f192, 0x0012f193, 0x0012f199,
+    0x0012f19b, 0x0012f1ab, 0x0012f1ad, 0x0012f1e3, 0x0012f1e9, 0x0012f285,
+    0x0012f46a, 0x0012f46d, 0x0012f46e, 0x0012f46f, 0x0012f473, 0x0012f477,
+    0x0012f47b, 0x0012f47d, 0x0012f49f, 0x0012f4bb, 0x0012f4bf, 0x0012f4cb,
+    0x0012f4ef, 0x0012f50d, 0x0012f513, 0x0012f55d, 0x0012f561, 0x0012f651,
+    0x0012f743, 0x0012f747, 0x0012fcf7, 0x0012fcfd, 0x0012fd0f, 0x0012fd47,
+    0x0012fd4d, 0x0012fde9, 0x00130583, 0x00130584, 0x00130585, 0x00130589,
+    0x0013058d, 0x00130590, 0x00130591, 0x00130593, 0x0013059b, 0x0013059f,
+    0x001305ab, 0x001305b5, 0x001305b7, 0x001305bd, 0x001305d5, 0x001305e1,
+    0x00130623, 0x00130629, 0x00130677, 0x00130683, 0x00130767, 0x0013076d,
+    0x0013085d, 0x00130869, 0x00130b33, 0x00130b39, 0x00130e0f, 0x00130e1b,
+    0x00131697, 0x0013169d, 0x00131f22, 0x00131f23, 0x00131f28, 0x00131f29,
+    0x00131f2b, 0x00131f3b, 0x00131f3d, 0x00131f43, 0x00131f73, 0x00131f79,
+    0x00132015, 0x0013201b, 0x00132201, 0x001327ad, 0x001327b3, 0x001338c5,
+    0x001338c6, 0x001338c7, 0x001338cb, 0x001338cf, 0x001338d3, 0x001338d5,
+    0x001338dd, 0x001338e1, 0x001338f7, 0x001338f9, 0x00133917, 0x00133923,
+    0x00133965, 0x0013396b, 0x001339b9, 0x00133aa9, 0x00133b9f, 0x00133e75,
+    0x00134151, 0x00135267, 0x00135273, 0x00136c05, 0x00136c0b, 0x001385a6,
+    0x001385a7, 0x001385ad, 0x001385af, 0x001385bf, 0x001385c1, 0x001385f7,
+    0x001385fd, 0x00138699, 0x00139f47, 0x00139f4d, 0x0013d28b, 0x0013d28c,
+    0x0013d28d, 0x0013d291, 0x0013d295, 0x0013d299, 0x0013d2a3, 0x0013d2a7,
+    0x0013d2bd, 0x0013d2dd, 0x0013d2e9, 0x0013d32b, 0x0013d331, 0x0013d37f,
+    0x0013d46f, 0x0013d565, 0x0013db17, 0x0013ec2d, 0x0013ec39, 0x001405cb,
+    0x001405d1, 0x0014b933, 0x0014b939, 0x0014b94b, 0x0014b983, 0x0014b989,
+    0x0014d2d3, 0x0014d2d9, 0x00159fdc, 0x00159fe2, 0x00159ff4, 0x00159ff7,
+    0x00159ffd, 0x0015a02c, 0x0015a02d, 0x0015a032, 0x0015a033, 0x0015a035,
+    0x0015a045, 0x0015a047, 0x0015a04d, 0x0015a0cf, 0x0015a0d5, 0x0015a0e7,
+    0x0015a11f, 0x0015a125, 0x0015a2b5, 0x0015a2bb, 0x0015a2cd, 0x0015a305,
+    0x0015a30b, 0x0015a867, 0x0015a86d, 0x0015a87f, 0x0015a8b7, 0x0015a8bd,
+    0x0015b97c, 0x0015b97d, 0x0015b982, 0x0015b983, 0x0015b985, 0x0015b995,
+    0x0015b997, 0x0015b99d, 0x0015b9cd, 0x0015b9d3, 0x0015ba6f, 0x0015bc55,
+    0x0015bc5b, 0x0015c207, 0x0015c20d, 0x0015ecbf, 0x0015ecc5, 0x0015ecd7,
+    0x0015ed0f, 0x0015ed15, 0x0016065f, 0x00160665, 0x00168685, 0x0016868b,
+    0x0016869d, 0x001686d5, 0x001686db, 0x0016a025, 0x0016a02b, 0x00185cb7,
+    0x00185cc3, 0x00185cc7, 0x00185ce7, 0x00185ceb, 0x00185cf7, 0x00185d06,
+    0x00185d07, 0x00185d0b, 0x00185d0f, 0x00185d12, 0x00185d13, 0x00185d15,
+    0x00185d1d, 0x00185d21, 0x00185d2d, 0x00185d37, 0x00185d39, 0x00185d3f,
+    0x00185df9, 0x00185e05, 0x00185e9b, 0x00185ea7, 0x00185eef, 0x00185fdf,
+    0x00185feb, 0x00186267, 0x00186273, 0x001862b5, 0x001862bb, 0x0018653f,
+    0x00186540, 0x00186541, 0x00186545, 0x00186549, 0x0018654c, 0x0018654d,
+    0x0018654f, 0x00186557, 0x0018655b, 0x00186567, 0x00186571, 0x00186573,
+    0x00186579, 0x0018658e, 0x0018658f, 0x00186594, 0x00186595, 0x00186597,
+    0x001865a7, 0x001865a9, 0x001865af, 0x00186633, 0x0018663f, 0x00186681,
+    0x00186687, 0x00186723, 0x00186729, 0x00186819, 0x00186825, 0x00186867,
+    0x0018686d, 0x00186aef, 0x00186af5, 0x00187613, 0x00187617, 0x00187637,
+    0x0018763b, 0x00187647, 0x001876b3, 0x001877f7, 0x00187bb7, 0x00187bc3,
+    0x00187e8f, 0x00187e90, 0x00187e91, 0x00187e95, 0x00187e99, 0x00187e9c,
+    0x00187e9d, 0x00187e9f, 0x00187ea7, 0x00187eab, 0x00187eb7, 0x00187ec1,
+    0x00187ec3, 0x00187ee1, 0x00187eed, 0x00187f2f, 0x00187f35, 0x00187f83,
+    0x00187f8f, 0x00188073, 0x00188079, 0x00188169, 0x00188175, 0x0018843f,
+    0x00188fb2, 0x00188fb3, 0x00188fb5, 0x00188fbd, 0x00188fc1, 0x00188fcd,
+    0x00188fd7, 0x00188fd9, 0x00188fdf, 0x001890a5, 0x0018927f, 0x0018928b,
+    0x00189555, 0x0018955b, 0x0018982e, 0x0018982f, 0x00189834, 0x00189835,
+    0x00189837, 0x00189847, 0x00189849, 0x0018984f, 0x0018987f, 0x00189885,
+    0x00189921, 0x00189927, 0x00189b07, 0x00189b0d, 0x0018b223, 0x0018b22f,
+    0x0018b271, 0x0018b277, 0x0018cb73, 0x0018cb7f, 0x0018e511, 0x0018ff03,
+    0x0018ff09, 0x00191853, 0x00194be9, 0x00194bf5, 0x00194c37, 0x00194c3d,
+    0x00196539, 0x00197ed7, 0x001a2a07, 0x001a2a13, 0x001a2a5b, 0x001a328f,
+    0x001a3295, 0x001a4bdf, 0x001b0833, 0x001b0837, 0x001b0857, 0x001b085b,
+    0x001b0867, 0x001b087f, 0x001b0882, 0x001b0883, 0x001b0885, 0x001b088d,
+    0x001b0891, 0x001b089d, 0x001b08a7, 0x001b08a9, 0x001b08af, 0x001b0975,
+    0x001b0a17, 0x001b0a5f, 0x001b0b5b, 0x001b0e2b, 0x001b1101, 0x001b110d,
+    0x001b193b, 0x001b1989, 0x001b198f, 0x001b2183, 0x001b2187, 0x001b21a7,
+    0x001b21ab, 0x001b2223, 0x001b328b, 0x001b3b22, 0x001b3b23, 0x001b3b25,
+    0x001b3b2d, 0x001b3b31, 0x001b3b3d, 0x001b3b47, 0x001b3b49, 0x001b3b4f,
+    0x001b3b73, 0x001b3c15, 0x001b3dfb, 0x001b43a1, 0x001b43ad, 0x001b4c29,
+    0x001b5565, 0x001b8805, 0x001ba1f7, 0x001bef2b, 0x001c21cb, 0x001dbc1f,
+    0x001dbc21, 0x001dbc25, 0x001dbc2d, 0x001dbc37, 0x001dbc51, 0x001dbc6f,
+    0x001dbc74, 0x001dbc75, 0x001dbc77, 0x001dbc87, 0x001dbc89, 0x001dbc8f,
+    0x001dbd67, 0x001dbf4d, 0x001dc4ff, 0x001dd56f, 0x001dd570, 0x001dd571,
+    0x001dd575, 0x001dd579, 0x001dd57d, 0x001dd587, 0x001dd58b, 0x001dd5a1,
+    0x001dd5c1, 0x001dd5cd, 0x001dd663, 0x001dd849, 0x001def0f, 0x001def15,
+    0x001def17, 0x001def27, 0x001def29, 0x001def2f, 0x001e2253, 0x00207887,
+    0x002080df, 0x002080e1, 0x002080e5, 0x002080ed, 0x002080f7, 0x00208111,
+    0x00208131, 0x0020813d, 0x00209a81, 0x00209a8d, 0x002323f7, 0x0025d7bf,
+    0x0025d7c1, 0x0025d7c5, 0x0025d7cd, 0x0025d7d7, 0x0025d7f1, 0x0025d811,
+    0x0025d81d, 0x0025f161, 0x00289477, 0x00289cd5, 0x00289ce7, 0x002b3fcd,
+    0x002b3fe7, 0x002df3b5, 0x002df3c7, 0x0030d267, 0x0030d279, 0x00335c5f,
+    0x00335c61, 0x0033755f, 0x00337579, 0x00338eff, 0x00338f01, 0x00362959,
+    0x0038d4c9, 0x003b77af, 0x003b77c9, 0x003e2ba9, 0x0043939f, 0x0053cb9d,
+    0x00567f7d, 0x00567f97, 0x005be78d, 0x005e9b6d, 0x009f7af5, 0x00e30e7f,
+    0x00e30e8b, 0x00e30e94, 0x00e30e97, 0x00e30ee5, 0x00e30f35, 0x00e30f87,
+    0x00e3105f, 0x00e31079, 0x00e32835, 0x00e341d5, 0x00e35b77, 0x00e3a859,
+    0x00eb2a84, 0x00eb2a87, 0x00eb2a8d, 0x00eb2b77, 0x00eb2d5d, 0x00eb32f5,
+};
+
+static const unsigned char opening_book_moves[BOOK_SIZE] = {
+    5, 5, 0, 2, 4, 1, 3, 5, 5, 4, 6, 1, 2, 5, 1, 6,
+    6, 4, 5, 5, 8, 8, 5, 6, 5, 8, 8, 6, 5, 8, 1, 0,
+    2, 5, 0, 1, 5, 0, 8, 8, 8, 7, 5, 8, 7, 5, 5, 5,
+    8, 8, 5, 8, 1, 1, 0, 3, 5, 5, 1, 5, 2, 2, 5, 1,
+    1, 6, 5, 5, 6, 5, 2, 1, 0, 0, 6, 9, 6, 10, 8, 8,
+    8, 6, 10, 9, 9, 10, 4, 0, 2, 8, 0, 1, 9, 0, 10, 6,
+    10, 9, 9, 10, 8, 8, 4, 8, 4, 10, 9, 4, 6, 6, 3, 6,
+    6, 3, 6, 3, 2, 1, 0, 6, 6, 2, 6, 2, 1, 0, 6, 1,
+    0, 10, 8, 8, 8, 8, 3, 10, 9, 3, 8, 8, 8, 6, 10, 8,
+    8, 6, 10, 9, 10, 9, 2, 8, 1, 0, 1, 2, 2, 1, 1, 0,
+    3, 9, 8, 11, 6, 2, 2, 9, 1, 1, 9, 9, 8, 8, 8, 2,
+    1, 0, 10, 10, 8, 9, 10, 10, 9, 9, 8, 8, 8, 9, 10, 10,
+    9, 9, 10, 9, 8, 8, 8, 8, 0, 2, 0, 1, 0, 1, 0, 6,
+    2, 6, 1, 6, 5, 5, 5, 3, 5, 5, 3, 5, 3, 2, 1, 0,
+    5, 5, 2, 5, 2, 1, 0, 5, 1, 0, 9, 8, 11, 11, 5, 10,
+    10, 8, 10, 10, 5, 11, 11, 9, 9, 8, 9, 9, 8, 0, 9, 9,
+    0, 1, 11, 2, 10, 1, 0, 1, 0, 4, 3, 4, 3, 4, 3, 2,
+    1, 4, 2, 7, 7, 8, 7, 2, 8, 0, 7, 1, 0, 8, 0, 0,
+    7, 1, 0, 0, 9, 9, 11, 11, 9, 10, 10, 10, 10, 9, 8, 11,
+    8, 9, 9, 10, 9, 9, 10, 9, 9, 8, 8, 1, 11, 2, 10, 1,
+    0, 9, 10, 10, 9, 9, 10, 9, 8, 8, 8, 10, 9, 8, 8, 8,
+    11, 10, 1, 11, 2, 10, 1, 0, 9, 9, 0, 0, 8, 8, 9, 9,
+    8, 9, 8, 3, 11, 11, 8, 10, 10, 10, 8, 2, 11, 11, 1, 11,
+    10, 10, 10, 8, 9, 9, 9, 9, 9, 2, 1, 0, 5, 2, 5, 1,
+    5, 9, 8, 9, 11, 11, 8, 11, 10, 10, 10, 1, 11, 10, 9, 9,
+    9, 9, 10, 9, 2, 8, 1, 0, 1, 10, 0, 0, 2, 1, 0, 1,
+    4, 8, 7, 7, 7, 7, 7, 7, 7, 7, 7, 1, 2, 2, 5, 1,
+    5, 0, 3, 2, 1, 5, 5, 11, 5, 8, 8, 5, 8, 8, 8, 5,
+    5, 5, 5, 5, 11, 11, 8, 11, 11, 8, 11, 11, 11, 11, 5, 5,
+    2, 5, 1, 0, 2, 1, 0, 6, 2, 1, 6, 6, 8, 6, 2, 8,
+    0, 6, 1, 0, 8, 0, 0, 6, 1, 0, 0, 9, 10, 10, 9, 9,
+    10, 9, 8, 8, 8, 10, 9, 8, 8, 8, 9, 9, 6, 6, 6, 6,
+    6, 6, 11, 6, 6, 6, 5, 5, 8, 5, 5, 8, 0, 5, 5, 0,
+    8, 0, 0, 5, 5, 0, 0, 10, 9, 8, 1, 3, 8, 11, 10, 0,
+    5, 5, 5, 5, 5, 5, 11, 5, 5, 5, 9, 10, 9, 8, 11, 8,
+    8, 2, 2, 1, 0, 1, 2, 10, 9, 2, 8, 1, 0, 1, 10, 0,
+    0, 1, 10, 0, 5, 5, 5, 4, 4, 6, 9, 4, 1, 0, 2, 5,
+    0, 1, 10, 0, 4, 4, 4, 7, 5, 4, 5, 5, 5, 5, 4, 4,
+    4, 4, 3, 0, 12, 12, 0, 2, 1, 0, 0, 12, 12, 0, 1, 0,
+    0, 0, 5, 5, 10, 9, 6, 5, 2, 2, 9, 5, 1, 5, 9, 6,
+    6, 2, 2, 2, 5, 1, 0, 1, 1, 9, 0, 3, 2, 1, 0, 2,
+    2, 2, 2, 2, 1, 1, 9, 1, 0, 1, 2, 1, 9, 10, 9, 2,
+    2, 9, 2, 1, 0, 6, 10, 10, 9, 9, 4, 4, 4, 6, 10, 10,
+    9, 9, 10, 9, 4, 4, 6, 4, 0, 2, 0, 1, 0, 9, 0, 0,
+    10, 9, 0, 0, 0, 0, 6, 6, 6, 6, 2, 2, 2, 3, 1, 1,
+    11, 0, 3, 2, 1, 0, 2, 2, 11, 2, 2, 1, 0, 1, 1, 11,
+    2, 1, 0, 1, 2, 1, 9, 2, 11, 2, 9, 1, 0, 9, 1, 11,
+    9, 9, 9, 2, 9, 11, 0, 2, 1, 0, 1, 2, 1, 1, 0, 7,
+    0, 9, 10, 10, 9, 9, 10, 9, 4, 4, 11, 10, 9, 9, 4, 4,
+    11, 10, 10, 9, 0, 0, 9, 9, 11, 10, 9, 4, 4, 5, 2, 4,
+    5, 5, 3, 5, 11, 4, 10, 10, 5, 2, 2, 11, 11, 1, 11, 10,
+    10, 10, 4, 9, 9, 5, 9, 9, 0, 12, 12, 0, 1, 11, 0, 10,
+    12, 11, 10, 0, 9, 9, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    2, 2, 2, 2, 11, 10, 10, 10, 2, 11, 10, 2, 9, 9, 1, 11,
+    10, 9, 2, 1, 0, 2, 4, 0, 4, 0, 4, 4, 0, 4, 4, 4,
+    0, 7, 7, 7, 1, 2, 2, 5, 1, 1, 10, 0, 3, 2, 1, 0,
+    2, 5, 2, 2, 2, 5, 5, 1, 1, 6, 2, 1, 0, 12, 2, 1,
+    5, 5, 5, 5, 5, 5, 5, 10, 6, 6, 11, 11, 11, 5, 6, 6,
+    5, 2, 1, 0, 1, 2, 1, 1, 0, 6, 0, 9, 10, 10, 9, 9,
+    10, 9, 4, 4, 6, 10, 9, 11, 4, 4, 6, 6, 10, 9, 0, 0,
+    6, 6, 6, 6, 6, 2, 1, 0, 5, 2, 1, 5, 5, 5, 5, 10,
+    9, 0, 1, 9, 9, 10, 5, 11, 11, 5, 11, 10, 10, 10, 11, 11,
+    10, 9, 9, 9, 9, 12, 11, 10, 9, 5, 5, 5, 5, 5, 2, 11,
+    10, 9, 2, 4, 4, 4, 4, 4, 0, 4, 4, 11, 2, 4, 5, 5,
+    3, 5, 3, 4, 4, 4, 5, 2, 2, 4, 4, 1, 5, 4, 4, 6,
+    4, 11, 11, 5, 11, 11, 0, 12, 12, 0, 1, 0, 0, 0, 12, 0,
+    0, 0, 11, 11, 2, 2, 2, 5, 1, 0, 2, 5, 2, 0, 2, 2,
+    2, 2, 2, 0, 1, 9, 2, 2, 10, 2, 11, 11, 1, 0, 0, 11,
+    2, 1, 0, 2, 4, 6, 6, 6, 6, 6, 6, 6, 6, 6, 0, 6,
+    6, 6, 11, 2, 11, 2, 4, 1, 0, 4, 4, 11, 9, 9, 9, 11,
+    11, 11, 11, 1, 0, 0, 11, 2, 11, 11, 0, 9, 1, 0, 4, 11,
+    2, 4, 4, 11, 10, 9, 0, 4, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 0, 5, 5, 5, 2, 1, 0, 2, 0, 5, 2, 2, 2, 2, 5,
+    1, 1, 6, 9, 5, 5, 5, 2, 1, 0, 5, 5, 9, 6, 2, 6,
+    5, 1, 9, 5, 5, 5, 5, 5, 2, 6, 1, 0, 12, 2, 12, 1,
+    12, 10, 9, 3, 4, 4, 4, 6, 10, 4, 4, 6, 10, 9, 10, 9,
+    2, 0, 1, 0, 0, 6, 6, 6, 6, 1, 0, 6, 0, 12, 0, 0,
+    2, 2, 2, 1, 1, 2, 2, 2, 1, 5, 4, 11, 11, 5, 10, 10,
+    4, 10, 10, 5, 11, 5, 9, 9, 4, 9, 9, 4, 0, 9, 5, 5,
+    1, 11, 2, 10, 1, 0, 5, 5, 2, 5, 5, 1, 0, 5, 5, 5,
+    1, 0, 5, 5, 5, 0, 0, 12, 11, 12, 10, 12, 0, 9, 12, 0,
+    0, 0, 4, 4, 4, 2, 4, 0, 4, 1, 0, 4, 0, 0, 4, 1,
+    0, 0, 7, 12, 0, 0, 0, 2, 11, 2, 10, 1, 0, 9, 2, 2,
+    0, 2, 2, 2, 10, 2, 2, 1, 0, 2, 2, 2, 1, 1, 9, 2,
+    2, 1, 1, 0, 9, 2, 2, 1, 10, 9, 2, 0, 1, 0, 1, 10,
+    0, 1, 9, 10, 9, 9, 9, 4, 4, 4, 5, 4, 4, 4, 6, 9,
+    5, 5, 5, 11, 11, 4, 11, 11, 4, 11, 11, 5, 5, 5, 5, 2,
+    6, 1, 0, 5, 11, 5, 11, 2, 10, 9, 5, 5, 5, 11, 11, 5,
+    5, 2, 9, 9, 12, 0, 12, 0, 12, 0, 11, 12, 0, 0, 6, 6,
+    4, 6, 2, 4, 6, 6, 1, 0, 4, 0, 0, 6, 1, 0, 6, 6,
+    6, 6, 6, 6, 12, 0, 0, 0, 2, 2, 2, 1, 1, 0, 11, 2,
+    2, 0, 2, 2, 2, 9, 2, 5, 5, 4, 5, 5, 4, 0, 5, 5,
+    5, 4, 0, 5, 5, 5, 0, 0, 5, 5, 5, 5, 5, 12, 0, 0,
+    0, 2, 2, 2, 10, 2, 2, 10, 2, 2, 1, 1, 0, 11, 11, 0,
+    0, 11, 2, 2, 9, 11, 9, 10, 9, 4, 11, 9, 2, 1, 0, 1,
+    2, 2, 1, 1, 5, 2, 2, 1, 1, 0, 6, 5, 2, 1, 10, 9,
+    2, 0, 1, 0, 1, 10, 0, 1, 6, 1, 0, 6, 6, 1, 11, 2,
+    10, 1, 0, 9, 9, 0, 0, 5, 5, 0, 0, 0, 4, 1, 0, 0,
+    0, 6, 6, 6, 6, 6, 6, 4, 6, 6, 5, 1, 5, 5, 2, 7,
+    5, 5, 5, 11, 1, 5, 5, 2, 1, 0, 14, 14, 2, 14, 2, 14,
+    14, 14, 1, 0, 6, 6, 8, 6, 6, 8, 6, 6, 6, 0, 1, 5,
+    2, 1, 1, 0, 2, 1, 0, 0, 1, 13, 2, 1, 0, 1, 1, 1,
+    2, 1, 8, 0, 0, 1, 1, 0, 6, 6, 10, 6, 6, 10, 6, 6,
+    8, 8, 4, 6, 2, 6, 1, 0, 10, 0, 8, 14, 1, 14, 14, 6,
+    6, 6, 6, 1, 0, 3, 3, 0, 3, 3, 3, 3, 12, 12, 2, 12,
+    2, 1, 0, 12, 1, 0, 2, 1, 0, 1, 2, 1, 3, 2, 8, 0,
+    3, 1, 0, 12, 12, 0, 0, 2, 1, 0, 1, 2, 1, 0, 0, 0,
+    0, 3, 10, 3, 2, 10, 0, 3, 8, 8, 12, 12, 0, 0, 0, 8,
+    0, 0, 5, 5, 5, 5, 11, 5, 1, 3, 11, 11, 10, 5, 10, 5,
+    1, 2, 11, 11, 1, 11, 10, 10, 10, 1, 5, 2, 1, 1, 0, 14,
+    14, 2, 14, 11, 14, 11, 14, 10, 10, 14, 11, 10, 14, 1, 0, 14,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 0, 1, 13, 11, 1, 11,
+    1, 10, 1, 11, 10, 1, 1, 0, 1, 11, 10, 0, 1, 1, 0, 0,
+    1, 0, 4, 0, 4, 4, 0, 4, 4, 4, 14, 7, 7, 7, 7, 2,
+    2, 2, 8, 1, 1, 5, 0, 3, 2, 1, 0, 5, 5, 2, 2, 8,
+    0, 1, 1, 5, 2, 1, 0, 14, 2, 1, 8, 8, 8, 3, 6, 8,
+    6, 3, 5, 5, 8, 0, 0, 5, 1, 5, 8, 2, 1, 0, 1, 2,
+    1, 8, 0, 0, 0, 10, 10, 10, 3, 2, 10, 6, 8, 8, 8, 10,
+    0, 8, 10, 2, 10, 10, 10, 14, 8, 14, 6, 6, 6, 6, 6, 2,
+    1, 0, 1, 2, 1, 8, 0, 0, 0, 10, 0, 8, 12, 0, 5, 5,
+    11, 11, 4, 11, 10, 10, 10, 11, 11, 10, 1, 5, 5, 14, 11, 10,
+    14, 5, 5, 5, 5, 5, 1, 11, 10, 0, 0, 4, 4, 4, 4, 4,
+    14, 11, 5, 5, 4, 1, 3, 5, 6, 4, 5, 5, 6, 2, 6, 6,
+    1, 6, 6, 6, 0, 11, 5, 11, 11, 11, 14, 14, 2, 14, 2, 14,
+    14, 14, 1, 0, 1, 0, 0, 14, 11, 11, 11, 1, 5, 2, 1, 1,
+    0, 6, 6, 0, 0, 0, 1, 13, 2, 1, 0, 1, 1, 1, 0, 0,
+    1, 11, 11, 1, 0, 0, 11, 1, 1, 0, 0, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 14, 6, 6, 6, 6, 3, 2, 3, 2, 1, 0,
+    3, 1, 0, 11, 11, 1, 0, 0, 11, 3, 1, 0, 0, 1, 0, 0,
+    11, 0, 3, 1, 0, 0, 0, 5, 5, 5, 5, 5, 5, 5, 14, 5,
+    5, 5, 5, 1, 1, 0, 0, 0, 2, 1, 0, 10, 10, 2, 10, 2,
+    1, 0, 10, 1, 0, 1, 2, 1, 1, 0, 0, 10, 10, 0, 0, 1,
+    2, 1, 0, 10, 0, 0, 10, 1, 10, 10, 0, 6, 1, 0, 1, 2,
+    1, 0, 0, 0, 0, 10, 10, 2, 10, 11, 1, 11, 10, 10, 10, 10,
+    11, 10, 10, 1, 0, 0, 1, 11, 10, 0, 10, 5, 5, 5, 5, 1,
+    11, 10, 0, 0, 10, 4, 4, 4, 4, 7, 2, 1, 0, 10, 2, 1,
+    10, 10, 10, 10, 10, 10, 10, 10, 6, 10, 11, 10, 10, 5, 4, 10,
+    2, 10, 2, 1, 0, 10, 1, 0, 1, 0, 0, 10, 11, 11, 11, 1,
+    0, 0, 11, 10, 10, 0, 0, 0, 1, 0, 0, 11, 0, 10, 6, 6,
+    6, 6, 6, 1, 0, 0, 11, 0, 0, 10, 5, 5, 5, 5, 5, 0,
+    6, 6, 4, 6, 6, 4, 6, 6, 5, 5, 1, 5, 2, 1, 1, 0,
+    1, 0, 5, 14, 14, 0, 14, 6, 12, 0, 0, 4, 0, 0, 1, 1,
+    0, 0, 0, 6, 2, 2, 0, 2, 3, 5, 5, 12, 12, 0, 0, 0,
+    0, 0, 1, 5, 2, 1, 1, 0, 1, 2, 0, 1, 14, 14, 0, 14,
+    14, 1, 1, 0, 0, 0, 4, 4, 3, 2, 4, 4, 5, 5, 5, 4,
+    0, 5, 5, 2, 5, 4, 14, 14, 5, 14, 0, 12, 0, 0, 0, 4,
+    0, 0, 0, 0, 2, 2, 2, 0, 2, 2, 4, 0, 5, 0, 0, 2,
+    5, 2, 5, 4, 11, 14, 0, 1, 5, 2, 1, 1, 0, 6, 6, 0,
+    0, 14, 14, 0, 14, 0, 1, 1, 0, 0, 0, 3, 1, 0, 0, 0,
+    0, 1, 5, 2, 2, 5, 1, 1, 5, 5, 7, 11, 5, 2, 1, 0,
+    5, 1, 2, 5, 5, 1, 5, 8, 8, 5, 8, 6, 6, 6, 6, 6,
+    14, 2, 14, 1, 14, 10, 2, 2, 6, 10, 1, 8, 6, 10, 6, 10,
+    6, 6, 8, 6, 6, 6, 6, 6, 6, 6, 6, 6, 14, 14, 14, 14,
+    1, 2, 13, 1, 1, 0, 1, 13, 1, 5, 1, 2, 5, 5, 1, 5,
+    5, 5, 11, 1, 11, 2, 10, 1, 0, 5, 5, 5, 5, 1, 0, 0,
+    14, 14, 14, 14, 1, 0, 0, 4, 1, 0, 0, 14, 0, 1, 13, 1,
+    1, 2, 1, 0, 12, 2, 12, 1, 12, 0, 3, 0, 3, 3, 12, 12,
+    12, 12, 10, 0, 3, 8, 3, 3, 12, 12, 12, 12, 3, 3, 12, 5,
+    6, 3, 5, 5, 3, 3, 5, 5, 5, 6, 5, 11, 2, 11, 5, 1,
+    5, 11, 11, 11, 6, 6, 6, 6, 6, 6, 5, 11, 5, 5, 5, 5,
+    5, 8, 8, 5, 11, 5, 11, 6, 6, 6, 6, 14, 14, 14, 14, 14,
+    14, 11, 14, 14, 14, 6, 6, 6, 6, 2, 1, 0, 6, 1, 6, 1,
+    0, 0, 6, 6, 6, 6, 6, 6, 6, 6, 6, 14, 14, 14, 14, 1,
+    13, 13, 0, 1, 13, 11, 1, 13, 1, 0, 1, 13, 1, 1, 5, 2,
+    5, 5, 1, 5, 5, 5, 0, 1, 5, 0, 5, 0, 0, 5, 5, 5,
+    5, 5, 14, 14, 14, 14, 0, 1, 13, 1, 1, 1, 1, 0, 3, 0,
+    3, 3, 12, 12, 12, 0, 3, 3, 3, 12, 0, 3, 3, 3, 12, 3,
+    2, 1, 0, 2, 2, 2, 1, 8, 0, 2, 0, 1, 0, 8, 8, 2,
+    1, 10, 0, 2, 8, 1, 0, 2, 10, 2, 0, 6, 1, 6, 0, 6,
+    1, 11, 2, 1, 0, 5, 0, 5, 1, 0, 0, 5, 4, 1, 0, 0,
+    4, 5, 2, 2, 5, 5, 1, 5, 4, 4, 6, 4, 6, 6, 5, 6,
+    6, 12, 5, 0, 0, 6, 6, 14, 14, 14, 14, 2, 2, 6, 2, 6,
+    6, 6, 14, 0, 1, 13, 1, 1, 1, 5, 1, 2, 4, 11, 0, 0,
+    14, 0, 1, 5, 3, 3, 12, 12, 12, 12, 12, 12, 5, 5, 5, 5,
+    5, 5, 4, 4, 6, 11, 5, 11, 6, 6, 6, 6, 12, 5, 0, 6,
+    14, 14, 14, 14, 14, 1, 0, 6, 6, 14, 0, 1, 13, 1, 1, 1,
+    5, 5, 5, 5, 14, 1, 0, 3, 3, 3, 12, 3, 3, 4, 0, 2,
+    5, 1, 0, 2, 4, 2, 0, 0, 0, 0, 0, 2, 1, 2, 2, 0,
+    4, 11, 0, 5, 0, 0, 10, 2, 10, 1, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    11, 10, 10, 10, 10, 10, 10, 10, 10, 6, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 3, 9, 9, 9, 9, 3, 2, 1, 0, 9, 9, 9,
+    9, 2, 1, 0, 9, 1, 9, 1, 0, 1, 2, 1, 0, 9, 1, 9,
+    9, 9, 9, 9, 1, 9, 0, 1, 0, 1, 2, 1, 0, 0, 1, 9,
+    9, 1, 9, 9, 9, 9, 9, 1, 9, 0, 0, 0, 6, 2, 1, 0,
+    1, 2, 1, 1, 0, 0, 0, 1, 9, 0, 0, 0, 9, 9, 9, 11,
+    1, 11, 9, 1, 9, 9, 11, 9, 9, 9, 9, 9, 1, 11, 0, 9,
+    9, 5, 5, 5, 5, 1, 11, 0, 9, 0, 9, 4, 4, 4, 4, 7,
+    2, 1, 0, 1, 2, 1, 1, 0, 0, 0, 1, 9, 0, 0, 6, 1,
+    11, 0, 9, 5, 4, 9, 9, 9, 2, 1, 0, 9, 1, 9, 9, 9,
+    9, 9, 11, 11, 11, 1, 0, 0, 11, 9, 1, 9, 0, 9, 1, 0,
+    0, 11, 0, 9, 6, 6, 6, 6, 6, 1, 0, 0, 11, 0, 0, 5,
+    5, 5, 5, 5, 0, 5, 5, 5, 4, 4, 4, 5, 5, 4, 6, 5,
+    5, 5, 5, 0, 2, 6, 1, 0, 5, 2, 2, 5, 5, 5, 11, 6,
+    0, 12, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 2, 2,
+    2, 0, 2, 2, 4, 2, 2, 14, 5, 5, 4, 0, 5, 2, 1, 0,
+    1, 0, 5, 0, 2, 12, 0, 0, 4, 0, 0, 0, 0, 2, 2, 2,
+    2, 2, 5, 0, 2, 0, 1, 0, 5, 5, 2, 1, 5, 5, 5, 9,
+    5, 0, 0, 0, 0, 0, 13, 4, 13, 2, 4, 0, 13, 5, 5, 4,
+    0, 5, 13, 1, 13, 0, 13, 13, 5, 13, 13, 12, 0, 0, 0, 4,
+    0, 0, 0, 0, 13, 2, 2, 0, 2, 2, 4, 0, 5, 0, 0, 2,
+    1, 13, 13, 0, 13, 0, 5, 0, 2, 6, 1, 0, 2, 5, 2, 0,
+    5, 5, 5, 6, 5, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 2,
+    1, 8, 2, 1, 2, 1, 8, 0, 0, 8, 1, 0, 0, 1, 2, 1,
+    0, 1, 0, 8, 8, 1, 0, 0, 0, 6, 0, 0, 0, 1, 0, 8,
+    0, 1, 11, 0, 0, 8, 5, 5, 5, 5, 0, 8, 4, 4, 7, 8,
+    0, 0, 0, 6, 5, 8, 1, 0, 0, 4, 0, 5, 11, 1, 0, 0,
+    0, 0, 0, 2, 5, 0, 1, 0, 11, 11, 0, 0, 4, 0, 5, 0,
+    0, 2, 1, 0, 0, 0, 0, 2, 2, 5, 5, 1, 5, 5, 5, 5,
+    6, 6, 6, 6, 1, 5, 1, 6, 6, 6, 6, 14, 14, 14, 14, 15,
+    0, 0, 0, 6, 6, 6, 14, 0, 1, 13, 1, 1, 1, 5, 1, 0,
+    0, 14, 0, 1, 5, 0, 3, 3, 3, 12, 12, 3, 3, 12, 0, 3,
+    3, 12, 13, 13, 13, 5, 1, 5, 1, 13, 1, 5, 6, 6, 13, 5,
+    13, 6, 13, 14, 14, 14, 14, 1, 0, 0, 14, 13, 1, 13, 1, 1,
+    1, 1, 5, 14, 1, 3, 3, 3, 5, 0, 2, 1, 0, 5, 2, 0,
+    1, 3, 6, 5, 0, 0, 1, 0, 0, 1, 5, 1, 6, 6, 6, 6,
+    6, 14, 6, 1, 0, 3, 12, 13, 5, 13, 6, 14, 1, 1, 3, 0,
+    5, 0, 2, 5, 2, 0, 5, 0, 0, 1, 13, 0, 0, 13, 5, 5,
+    5, 5, 3, 4, 6, 6, 5, 5, 5, 4, 4, 5, 5, 6, 6, 6,
+    4, 0, 2, 5, 1, 0, 0, 0, 6, 5, 0, 6, 0, 0, 0, 2,
+    5, 2, 0, 6, 6, 6, 2, 2, 6, 2, 1, 0, 6, 0, 2, 0,
+    15, 0, 0, 15, 0, 0, 0, 5, 5, 4, 4, 11, 5, 9, 9, 4,
+    4, 11, 5, 0, 0, 5, 9, 0, 0, 0, 0, 4, 0, 2, 5, 14,
+    14, 0, 2, 2, 14, 0, 2, 14, 2, 2, 2, 2, 2, 5, 5, 4,
+    4, 5, 5, 6, 6, 6, 5, 11, 6, 4, 4, 5, 5, 5, 0, 6,
+    0, 5, 5, 5, 5, 11, 1, 0, 6, 0, 0, 0, 15, 0, 0, 0,
+    0, 5, 5, 5, 5, 5, 0, 2, 2, 14, 2, 2, 4, 13, 13, 5,
+    13, 13, 13, 13, 13, 13, 0, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+    13, 13, 13, 9, 2, 9, 1, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 11, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 5, 6, 6, 4, 4, 5, 5, 0, 6, 0, 0,
+    0, 12, 2, 2, 14, 2, 5, 0, 6, 2, 5, 13, 13, 13, 13, 13,
+    6, 6, 0, 0, 0, 0, 2, 5, 0, 0, 14, 1, 8, 0, 8, 8,
+    8, 8, 8, 8, 0, 8, 8, 8, 11, 11, 11, 11, 11, 11, 11, 11,
+    11, 11, 11, 11, 1, 2, 2, 5, 1, 6, 0, 3, 2, 1, 1, 6,
+    2, 1, 0, 12, 2, 1, 7, 6, 7, 5, 5, 5, 7, 6, 6, 7,
+    7, 7, 2, 6, 6, 5, 2, 1, 0, 2, 2, 1, 2, 2, 1, 2,
+    10, 10, 9, 9, 10, 9, 4, 4, 6, 10, 9, 7, 4, 4, 6, 6,
+    10, 9, 0, 0, 6, 6, 6, 6, 1, 2, 1, 1, 10, 9, 1, 1,
+    12, 0, 10, 9, 5, 5, 5, 5, 4, 4, 1, 0, 0, 15, 6, 5,
+    1, 9, 6, 2, 2, 6, 6, 7, 4, 4, 4, 7, 9, 5, 6, 5,
+    7, 7, 4, 7, 7, 4, 7, 7, 5, 5, 1, 6, 2, 1, 1, 0,
+    6, 6, 7, 2, 10, 9, 5, 5, 5, 7, 7, 5, 6, 2, 6, 9,
+    12, 6, 12, 0, 12, 0, 7, 12, 0, 0, 4, 4, 6, 10, 4, 4,
+    1, 10, 0, 4, 7, 7, 1, 10, 0, 4, 6, 6, 6, 6, 12, 0,
+    0, 0, 2, 6, 2, 1, 1, 0, 7, 2, 2, 0, 2, 2, 9, 2,
+    1, 3, 2, 4, 10, 1, 5, 4, 0, 5, 1, 1, 0, 1, 5, 5,
+    0, 12, 0, 0, 4, 0, 0, 0, 2, 0, 2, 7, 2, 2, 1, 1,
+    0, 7, 7, 0, 0, 2, 2, 9, 7, 10, 9, 4, 7, 3, 4, 3,
+    2, 4, 0, 3, 5, 5, 15, 15, 0, 15, 1, 0, 5, 15, 3, 12,
+    0, 0, 4, 0, 0, 0, 0, 2, 2, 0, 2, 4, 0, 5, 0, 0,
+    1, 0, 0, 0, 1, 6, 2, 1, 1, 0, 1, 5, 0, 1, 6, 5,
+    6, 10, 5, 10, 0, 4, 4, 6, 1, 0, 0, 0, 2, 1, 0, 10,
+    2, 1, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 4, 10, 10, 4, 10, 10, 5, 5, 4, 0, 5, 10,
+    10, 0, 10, 1, 0, 5, 0, 12, 0, 0, 0, 4, 0, 0, 0, 2,
+    2, 10, 2, 4, 0, 5, 0, 10, 0, 10, 0, 4, 0, 5, 0, 10,
+    0, 10, 0, 7, 6, 5, 5, 5, 5, 4, 4, 6, 7, 5, 7, 6,
+    6, 6, 6, 12, 5, 0, 6, 14, 14, 14, 14, 2, 2, 1, 6, 1,
+    13, 1, 1, 1, 5, 1, 1, 3, 3, 3, 12, 1, 5, 0, 6, 4,
+    6, 5, 5, 10, 6, 10, 10, 10, 10, 7, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 9, 4, 9, 2, 4,
+    0, 9, 5, 5, 4, 0, 5, 9, 1, 0, 0, 9, 9, 5, 9, 12,
+    0, 0, 0, 4, 0, 0, 0, 2, 2, 0, 2, 4, 0, 5, 0, 1,
+    9, 9, 0, 4, 0, 5, 0, 1, 0, 0, 9, 1, 5, 1, 6, 5,
+    6, 6, 7, 9, 6, 9, 9, 9, 9, 7, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 2, 0, 0, 0, 4,
+    6, 2, 1, 0, 1, 2, 5, 2, 2, 1, 1, 0, 6, 5, 2, 1,
+    10, 9, 2, 0, 1, 0, 1, 10, 0, 1, 1, 0, 6, 6, 5, 5,
+    0, 0, 1, 0, 1, 9, 1, 5, 2, 1, 1, 0, 6, 6, 0, 0,
+    14, 0, 14, 0, 1, 0, 0, 1, 0, 0, 4, 5, 4, 6, 5, 5,
+    1, 0, 2, 5, 0, 1, 5, 0, 5, 4, 1, 6, 6, 2, 6, 6,
+    4, 6, 6, 1, 6, 6, 2, 1, 0, 8, 8, 8, 8, 2, 8, 8,
+    8, 1, 8, 7, 5, 8, 5, 6, 5, 5, 1, 6, 2, 6, 1, 0,
+    2, 1, 0, 11, 4, 9, 2, 2, 8, 8, 1, 1, 9, 1, 2, 1,
+    0, 0, 6, 10, 9, 8, 6, 10, 10, 9, 9, 10, 9, 8, 8, 8,
+    14, 6, 2, 6, 1, 0, 9, 8, 8, 8, 8, 8, 6, 2, 1, 0,
+    9, 9, 2, 9, 2, 1, 0, 9, 1, 0, 1, 2, 1, 8, 9, 9,
+    9, 9, 0, 0, 1, 2, 1, 0, 10, 9, 8, 9, 9, 0, 0, 0,
+    9, 5, 4, 2, 11, 11, 1, 11, 10, 10, 10, 9, 9, 9, 9, 9,
+    9, 8, 11, 10, 8, 9, 9, 9, 5, 5, 5, 5, 1, 11, 10, 9,
+    9, 9, 9, 9, 10, 0, 4, 4, 4, 7, 1, 2, 2, 5, 1, 1,
+    5, 0, 3, 2, 1, 0, 6, 4, 2, 2, 4, 6, 1, 1, 6, 2,
+    1, 0, 8, 2, 1, 8, 8, 6, 5, 8, 5, 6, 5, 5, 8, 11,
+    11, 6, 6, 6, 6, 2, 1, 0, 6, 2, 1, 8, 6, 6, 6, 10,
+    10, 9, 9, 10, 9, 8, 8, 8, 10, 9, 8, 13, 1, 6, 6, 10,
+    9, 8, 8, 6, 6, 6, 6, 2, 1, 0, 1, 2, 1, 8, 0, 0,
+    0, 10, 9, 8, 9, 11, 4, 11, 11, 4, 11, 10, 10, 10, 11, 11,
+    10, 9, 9, 9, 8, 11, 10, 9, 5, 5, 5, 5, 1, 11, 10, 9,
+    4, 4, 4, 4, 11, 11, 6, 4, 6, 3, 6, 5, 4, 6, 5, 1,
+    2, 4, 5, 1, 5, 6, 5, 5, 11, 11, 11, 11, 11, 8, 8, 8,
+    8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 11, 11, 11, 1, 2, 2,
+    1, 1, 0, 1, 5, 2, 1, 4, 9, 4, 10, 8, 8, 4, 10, 9,
+    11, 11, 10, 11, 11, 11, 11, 1, 0, 0, 11, 10, 9, 8, 8, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 9, 2, 9,
+    9, 1, 0, 9, 9, 0, 9, 9, 9, 11, 11, 1, 0, 0, 11, 9,
+    0, 0, 9, 1, 0, 0, 11, 9, 0, 0, 9, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 10, 9, 8, 10, 1, 0, 4, 4, 4, 4,
+    2, 1, 0, 4, 1, 4, 6, 9, 6, 6, 5, 1, 2, 1, 2, 4,
+    4, 4, 4, 4, 1, 2, 1, 9, 0, 4, 11, 10, 4, 9, 9, 9,
+    5, 9, 4, 2, 1, 0, 4, 2, 1, 5, 2, 1, 6, 10, 9, 4,
+    4, 4, 11, 10, 9, 4, 4, 4, 4, 1, 0, 4, 4, 4, 4, 4,
+    4, 4, 11, 11, 11, 11, 11, 5, 5, 1, 0, 4, 11, 6, 6, 6,
+    6, 1, 0, 0, 11, 5, 5, 5, 5, 5, 5, 5, 1, 6, 2, 6,
+    1, 0, 6, 2, 9, 9, 0, 6, 10, 9, 9, 6, 4, 9, 5, 9,
+    9, 0, 0, 0, 0, 0, 2, 13, 2, 2, 1, 2, 10, 4, 4, 6,
+    2, 4, 9, 5, 5, 5, 4, 11, 5, 6, 2, 9, 9, 2, 2, 5,
+    2, 5, 0, 0, 0, 4, 6, 6, 6, 2, 2, 0, 2, 4, 0, 5,
+    0, 2, 2, 4, 11, 1, 2, 2, 1, 1, 0, 2, 5, 2, 1, 5,
+    5, 10, 5, 10, 9, 10, 10, 9, 0, 0, 9, 6, 6, 2, 6, 2,
+    6, 6, 6, 1, 0, 1, 2, 1, 6, 6, 0, 6, 1, 2, 1, 0,
+    6, 6, 6, 6, 0, 1, 11, 10, 4, 1, 5, 5, 0, 5, 0, 4,
+    2, 1, 0, 6, 2, 1, 8, 6, 6, 6, 10, 6, 8, 6, 1, 11,
+    10, 6, 2, 6, 6, 6, 6, 6, 6, 0, 6, 6, 6, 11, 11, 1,
+    0, 0, 11, 6, 0, 6, 6, 1, 0, 0, 11, 6, 6, 6, 6, 5,
+    5, 1, 2, 1, 0, 0, 0, 1, 0, 0, 11, 6, 6, 0, 6, 0,
+    0, 2, 4, 6, 5, 6, 6, 0, 6, 6, 6, 6, 6, 6, 6, 8,
+    6, 6, 6, 6, 6, 6, 6, 6, 4, 1, 11, 10, 0, 0, 1, 1,
+    2, 1, 10, 11, 4, 5, 5, 4, 5, 11, 1, 5, 11, 5, 11, 6,
+    6, 6, 8, 5, 8, 6, 14, 14, 14, 14, 6, 6, 6, 6, 1, 13,
+    1, 1, 5, 5, 5, 3, 3, 3, 2, 2, 2, 1, 0, 5, 2, 8,
+    8, 8, 8, 10, 3, 8, 10, 5, 11, 4, 6, 6, 6, 6, 4, 4,
+    5, 4, 6, 4, 4, 0, 10, 10, 10, 2, 1, 0, 6, 4, 2, 2,
+    6, 6, 1, 11, 8, 2, 1, 0, 0, 5, 5, 6, 6, 15, 2, 1,
+    0, 1, 9, 8, 6, 1, 6, 6, 8, 1, 2, 0, 0, 1, 11, 9,
+    9, 9, 5, 9, 4, 2, 1, 0, 13, 2, 8, 13, 13, 13, 13, 9,
+    8, 13, 13, 11, 6, 11, 5, 5, 6, 6, 5, 5, 1, 5, 11, 11,
+    8, 8, 8, 11, 5, 11, 6, 8, 15, 0, 0, 6, 6, 6, 6, 1,
+    0, 5, 5, 1, 2, 1, 9, 0, 9, 1, 0, 0, 11, 5, 5, 5,
+    0, 6, 2, 0, 0, 4, 13, 5, 13, 5, 5, 6, 1, 2, 0, 0,
+    1, 0, 0, 6, 6, 6, 6, 13, 5, 5, 3, 6, 5, 5, 4, 5,
+    5, 5, 6, 6, 1, 6, 2, 1, 0, 8, 6, 8, 8, 8, 8, 1,
+    2, 2, 2, 9, 0, 0, 15, 0, 0, 5, 9, 9, 0, 0, 9, 0,
+    2, 2, 2, 5, 5, 6, 2, 5, 5, 6, 6, 5, 11, 2, 5, 5,
+    8, 6, 8, 5, 0, 0, 11, 6, 6, 15, 0, 0, 5, 0, 2, 2,
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 6,
+    4, 4, 4, 0, 0, 0, 5, 4, 6, 4, 13, 13, 13, 9, 9, 9,
+    6, 0, 0, 5, 6, 13, 13, 0, 8, 8, 1, 2, 2, 5, 1, 6,
+    0, 3, 2, 1, 0, 6, 6, 2, 2, 4, 9, 1, 6, 2, 1, 0,
+    8, 2, 1, 8, 8, 7, 5, 8, 5, 6, 5, 6, 8, 7, 7, 6,
+    6, 6, 6, 2, 1, 0, 1, 2, 8, 0, 0, 9, 10, 10, 9, 9,
+    10, 9, 8, 8, 10, 9, 1, 6, 10, 9, 8, 8, 6, 6, 6, 2,
+    1, 0, 1, 2, 8, 9, 0, 0, 10, 9, 7, 4, 7, 2, 4, 5,
+    10, 10, 7, 7, 9, 9, 8, 8, 10, 9, 5, 5, 5, 2, 2, 4,
+    2, 1, 0, 15, 2, 8, 0, 0, 15, 10, 9, 1, 0, 6, 6, 9,
+    5, 5, 5, 5, 6, 5, 5, 6, 8, 8, 8, 8, 6, 6, 0, 0,
+    1, 2, 6, 6, 1, 9, 5, 2, 1, 0, 4, 2, 1, 5, 2, 1,
+    6, 10, 9, 4, 4, 4, 4, 10, 9, 4, 4, 4, 4, 4, 4, 7,
+    2, 4, 9, 5, 5, 5, 4, 7, 5, 6, 2, 6, 9, 2, 2, 5,
+    2, 0, 0, 0, 4, 0, 0, 9, 2, 0, 4, 9, 5, 0, 2, 4,
+    4, 0, 5, 15, 5, 6, 10, 2, 1, 0, 1, 2, 8, 0, 0, 0,
+    10, 0, 10, 10, 1, 0, 4, 0, 5, 0, 7, 6, 5, 5, 4, 5,
+    1, 6, 7, 5, 6, 6, 8, 5, 8, 6, 14, 14, 14, 4, 2, 13,
+    1, 5, 3, 1, 5, 5, 4, 5, 4, 6, 10, 10, 2, 1, 0, 9,
+    2, 8, 9, 9, 9, 9, 9, 9, 9, 9, 9, 4, 9, 5, 9, 1,
+    5, 5, 5, 7, 2, 5, 5, 6, 5, 7, 2, 5, 8, 6, 8, 6,
+    0, 7, 2, 2, 0, 5, 9, 5, 0, 13, 5, 4, 6, 4, 9, 9,
+    5, 6, 9, 6, 6, 3, 6, 6, 4, 7, 1, 2, 6, 6, 1, 6,
+    6, 7, 7, 7, 8, 8, 8, 6, 8, 6, 8, 8, 8, 8, 6, 8,
+    8, 7, 7, 7, 2, 2, 1, 1, 0, 1, 6, 2, 1, 4, 9, 6,
+    6, 8, 6, 10, 1, 6, 7, 1, 6, 0, 7, 9, 8, 9, 2, 1,
+    1, 8, 8, 9, 9, 9, 9, 1, 0, 9, 9, 9, 7, 1, 0, 0,
+    7, 9, 0, 9, 1, 0, 2, 1, 1, 8, 1, 6, 10, 6, 10, 6,
+    1, 1, 1, 8, 6, 8, 8, 9, 6, 6, 6, 6, 1, 1, 3, 3,
+    15, 3, 3, 3, 3, 3, 4, 4, 4, 6, 1, 6, 4, 4, 4, 4,
+    6, 4, 4, 7, 7, 7, 7, 5, 1, 6, 4, 7, 4, 4, 1, 0,
+    0, 7, 4, 1, 4, 6, 4, 4, 3, 3, 2, 2, 1, 1, 0, 1,
+    2, 1, 7, 7, 9, 7, 9, 0, 0, 0, 6, 2, 6, 6, 6, 6,
+    6, 6, 6, 7, 1, 6, 0, 7, 0, 6, 1, 6, 6, 1, 6, 0,
+    7, 0, 6, 10, 10, 10, 10, 10, 10, 10, 6, 7, 6, 6, 5, 1,
+    7, 8, 6, 8, 7, 7, 6, 15, 6, 1, 13, 1, 6, 0, 7, 7,
+    6, 1, 9, 9, 9, 9, 9, 9, 9, 2, 1, 0, 0, 2, 0, 1,
+    0, 10, 9, 2, 8, 1, 0, 0, 0, 1, 11, 2, 10, 1, 0, 5,
+    1, 0, 0, 4, 1, 0, 0, 4, 3, 5, 6, 3, 3, 5, 6, 5,
+    5, 6, 11, 2, 11, 11, 1, 11, 11, 11, 11, 5, 5, 2, 5, 1,
+    0, 11, 5, 11, 8, 6, 6, 11, 8, 6, 11, 11, 11, 0, 8, 13,
+    6, 8, 8, 8, 8, 8, 8, 8, 8, 6, 2, 6, 2, 1, 0, 6,
+    1, 0, 1, 0, 0, 6, 1, 0, 0, 6, 6, 6, 6, 8, 8, 2,
+    2, 1, 1, 0, 11, 0, 0, 9, 9, 5, 2, 5, 5, 1, 0, 5,
+    5, 0, 1, 0, 0, 5, 0, 0, 5, 5, 5, 5, 8, 8, 11, 10,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 2, 1, 0, 1,
+    2, 2, 1, 0, 2, 0, 1, 0, 8, 2, 1, 9, 2, 8, 1, 0,
+    10, 0, 0, 0, 0, 11, 2, 1, 0, 9, 0, 0, 0, 0, 0, 5,
+    1, 0, 2, 4, 11, 0, 0, 0, 5, 13, 5, 4, 5, 5, 10, 4,
+    6, 11, 11, 11, 5, 4, 13, 5, 1, 0, 0, 0, 6, 5, 1, 0,
+    6, 0, 6, 6, 5, 5, 5, 5, 9, 9, 0, 2, 5, 1, 0, 4,
+    2, 0, 0, 0, 0, 11, 0, 4, 4, 4, 4, 4, 4, 4, 4, 9,
+    9, 4, 4, 4, 4, 1, 1, 0, 10, 0, 3, 5, 3, 3, 8, 8,
+    3, 8, 5, 1, 0, 0, 1, 5, 8, 14, 14, 14, 14, 8, 8, 1,
+    0, 0, 0, 4, 4, 1, 0, 0, 5, 4, 5, 2, 1, 0, 6, 0,
+    0, 14, 0, 0, 10, 10, 10, 0, 0, 4, 4, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 0, 0, 6, 6, 5, 0, 2, 1, 0,
+    11, 6, 0, 0, 0, 1, 0, 0, 0, 13, 13, 13, 2, 1, 0, 1,
+    13, 1, 0, 1, 13, 13, 13, 13, 13, 8, 8, 1, 0, 0, 13, 0,
+    1, 0, 9, 0, 2, 1, 0, 5, 2, 6, 6, 0, 0, 0, 1, 0,
+    0, 9, 0, 4, 4, 1, 0, 0, 6, 2, 2, 1, 0, 11, 0, 5,
+    5, 0, 0, 5, 5, 5, 6, 6, 7, 1, 3, 7, 9, 7, 6, 6,
+    7, 2, 7, 7, 1, 7, 7, 0, 1, 6, 2, 1, 0, 6, 7, 8,
+    13, 9, 6, 8, 6, 7, 7, 7, 6, 8, 6, 13, 6, 8, 8, 8,
+    8, 8, 8, 8, 2, 6, 10, 8, 8, 10, 0, 7, 7, 10, 0, 6,
+    6, 6, 8, 8, 6, 2, 1, 0, 7, 0, 6, 6, 3, 4, 1, 10,
+    1, 1, 0, 1, 5, 0, 0, 8, 0, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 3, 2, 3, 2, 1, 0, 1, 0, 15, 1, 0, 0, 15, 8,
+    8, 1, 0, 0, 1, 0, 2, 1, 6, 6, 6, 0, 6, 7, 4, 5,
+    5, 7, 4, 6, 7, 7, 7, 4, 6, 5, 0, 0, 6, 5, 2, 1,
+    6, 6, 2, 1, 9, 9, 0, 0, 6, 5, 6, 4, 4, 4, 4, 4,
+    4, 4, 6, 9, 4, 4, 4, 4, 4, 2, 10, 10, 10, 10, 10, 0,
+    1, 0, 10, 0, 0, 0, 8, 8, 0, 0, 0, 0, 0, 10, 10, 4,
+    4, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 2, 9, 2, 1,
+    0, 1, 1, 0, 1, 9, 9, 8, 8, 0, 0, 0, 0, 9, 9, 4,
+    4, 2, 1, 7, 6, 5, 6, 5, 2, 1, 1, 2, 1, 0, 2, 0,
+    1, 0, 8, 2, 1, 2, 1, 10, 0, 0, 2, 1, 9, 5, 0, 2,
+    1, 6, 9, 6, 0, 2, 5, 1, 0, 4, 2, 0, 0, 0, 0, 7,
+    0, 9, 5, 2, 1, 6, 0, 14, 0, 0, 2, 1, 5, 7, 6, 9,
+    0, 2, 1, 0, 10, 2, 1, 10, 10, 8, 10, 10, 10, 10, 8, 0,
+    0, 10, 10, 10, 0, 0, 9, 8, 6, 0, 0, 11, 10, 5, 5, 5,
+    5, 8, 5, 5, 5, 8, 5, 5, 5, 5, 11, 11, 11, 2, 2, 1,
+    1, 0, 5, 2, 1, 0, 0, 9, 0, 6, 6, 5, 5, 11, 10, 5,
+    5, 1, 0, 10, 2, 1, 10, 10, 11, 10, 5, 4, 4, 5, 5, 4,
+    4, 6, 5, 5, 6, 11, 11, 0, 0, 11, 5, 0, 9, 6, 6, 2,
+    1, 5, 10, 5, 5, 4, 0, 5, 10, 10, 10, 0, 0, 5, 10, 10,
+    2, 2, 1, 1, 0, 5, 2, 1, 5, 11, 9, 9, 11, 10, 0, 0,
+    5, 5, 0, 0, 5, 3, 3, 3, 2, 1, 8, 6, 9, 4, 0, 6,
+    0, 5, 5, 5, 1, 0, 1, 2, 1, 5, 7, 5, 6, 8, 7, 7,
+    6, 6, 6, 9, 8, 6, 1, 5, 0, 0, 2, 6, 8, 1, 0, 1,
+    2, 1, 2, 5, 5, 5, 4, 7, 5, 2, 6, 4, 5, 9, 5, 0,
+    5, 6, 0, 5, 1, 0, 5, 7, 6, 7, 8, 1, 7, 2, 1, 1,
+    0, 6, 2, 1, 0, 10, 10, 7, 6, 6, 5, 6, 4, 1, 6, 7,
+    6, 0, 6, 2, 2, 1, 0, 1, 2, 1, 6, 1, 14, 14, 14, 14,
+    14, 11, 0, 0, 0, 0, 14, 14, 6, 14, 14, 14, 7, 6, 0, 6,
+    10, 1, 6, 7, 1, 1, 6, 10, 10, 7, 0, 7, 4, 7, 0, 4,
+    10, 7, 9, 7, 14, 13, 13, 7, 1, 6, 6, 2, 1, 4, 4, 8,
+    6, 10, 10, 1, 4, 2, 6, 6, 1, 2, 1, 10, 4, 11,
+};
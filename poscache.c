@@ -0,0 +1,267 @@
+#include <linux/atomic.h>
+#include <linux/kernel.h>
+#include <linux/moduleparam.h>
+#include <linux/string.h>
+#include <linux/vmalloc.h>
+
+#include "game.h"
+#include "hugemem.h"
+#include "poscache.h"
+#include "zobrist.h"
+
+/* Entries of a bucket share a cache line */
+#define POSCACHE_WAYS 4
+#define POSCACHE_MIN_BITS 10
+#define POSCACHE_MAX_BITS 24
+
+/* Layout of the data word */
+#define DATA_MOVE(d) ((int) ((d) & 0xff))
+#define DATA_VALUE(d) ((int) (s16) (((d) >> 8) & 0xffff))
+#define DATA_DEPTH(d) ((int) (((d) >> 24) & 0xff))
+#define DATA_VALID (1ULL << 32)
+#define DATA_PROVEN (1ULL << 33)
+#define DATA_ENGINE(d) ((enum poscache_engine) (((d) >> 36) & 0xf))
+#define DATA_GENERATION(d) ((u8) ((d) >> 40))
+#define DATA_EFFORT(d) ((unsigned int) ((d) >> 48))
+
+/* Effort is kept in units of 1 << EFFORT_SHIFT nodes */
+#define EFFORT_SHIFT 10
+
+#define SIDE_KEY 0xd1b54a32d192ed03ULL
+
+struct poscache_entry {
+    u64 check; /* key ^ data */
+    u64 data;
+};
+
+static bool use_cache = true;
+module_param(use_cache, bool, 0644);
+MODULE_PARM_DESC(use_cache, "Share search results across games");
+
+static unsigned int cache_bits = 16;
+module_param(cache_bits, uint, 0444);
+MODULE_PARM_DESC(cache_bits, "Log2 of the number of position cache entries");
+
+static struct poscache_entry *cache;
+static u64 cache_mask;
+
+/* Games played so far, the older an entry the sooner it is replaced */
+static u8 generation;
+
+static atomic_long_t n_probes, n_hits, n_stores, n_evictions, n_used;
+
+/* Grid under the s-th symmetry of a board of size, as symmetry_grid() */
+static int sym_grid(int size, int s, int grid)
+{
+    int i = grid / size, j = grid % size;
+
+    if (s & 1)
+        i = size - 1 - i;
+    if (s & 2)
+        j = size - 1 - j;
+    if (s & 4)
+        swap(i, j);
+    return i * size + j;
+}
+
+/* sym_grid() of every grid of the variant sym_variant */
+static u8 sym_map[8][MAX_GRIDS];
+static const struct game_variant *sym_variant;
+
+static void sym_map_update(void)
+{
+    if (sym_variant == game)
+        return;
+    for (int s = 0; s < 8; s++)
+        for (int g = 0; g < game->n_grids; g++)
+            sym_map[s][g] = sym_grid(game->board_size, s, g);
+    sym_variant = game;
+}
+
+/* Grid mapped to canonical by the s-th symmetry, -1 if off the board */
+static int unsym_grid(int s, int canonical)
+{
+    for (int g = 0; g < game->n_grids; g++)
+        if (sym_map[s][g] == canonical)
+            return g;
+    return -1;
+}
+
+void poscache_key_init(struct poscache_key *k, const char *table, char player)
+{
+    u64 salt = ((u64) game->board_size << 8 | game->goal) *
+               0x9e3779b97f4a7c15ULL;
+
+    sym_map_update();
+    if (player == 'X')
+        salt ^= SIDE_KEY;
+    for (int s = 0; s < 8; s++)
+        k->keys[s] = salt;
+    for (int g = 0; g < game->n_grids; g++)
+        if (table[g] != ' ')
+            for (int s = 0; s < 8; s++)
+                k->keys[s] ^= zobrist_table[sym_map[s][g]][table[g] == 'X'];
+}
+
+/* Adds the stone of player at grid, or takes it back, and passes the turn */
+void poscache_key_play(struct poscache_key *k, int grid, char player)
+{
+    for (int s = 0; s < 8; s++)
+        k->keys[s] ^= zobrist_table[sym_map[s][grid]][player == 'X'] ^ SIDE_KEY;
+}
+
+/* Returns the canonical key of the position and stores in *sym the
+ * symmetry that maps it to its canonical orientation.
+ */
+static u64 canonical_key(const struct poscache_key *k, int *sym)
+{
+    *sym = 0;
+    for (int s = 1; s < 8; s++)
+        if (k->keys[s] < k->keys[*sym])
+            *sym = s;
+    return k->keys[*sym];
+}
+
+static struct poscache_entry *bucket(u64 key)
+{
+    return &cache[key & cache_mask & ~(u64) (POSCACHE_WAYS - 1)];
+}
+
+bool poscache_probe(const char *table, char player, struct poscache_result *r)
+{
+    struct poscache_key k;
+
+    if (!cache || !READ_ONCE(use_cache))
+        return false;
+    poscache_key_init(&k, table, player);
+    return poscache_probe_key(&k, table, r);
+}
+
+bool poscache_probe_key(const struct poscache_key *k,
+                        const char *table,
+                        struct poscache_result *r)
+{
+    struct poscache_entry *b;
+    int sym;
+
+    if (!cache || !READ_ONCE(use_cache))
+        return false;
+    u64 key = canonical_key(k, &sym);
+    atomic_long_inc(&n_probes);
+    b = bucket(key);
+    for (int w = 0; w < POSCACHE_WAYS; w++) {
+        u64 data = READ_ONCE(b[w].data);
+        if (!(data & DATA_VALID) || (READ_ONCE(b[w].check) ^ data) != key)
+            continue;
+
+        r->move = unsym_grid(sym, DATA_MOVE(data));
+        /* A colliding key may point at an occupied grid */
+        if (r->move < 0 || table[r->move] != ' ')
+            return false;
+        r->value = DATA_VALUE(data);
+        r->depth = DATA_DEPTH(data);
+        r->effort = DATA_EFFORT(data) << EFFORT_SHIFT;
+        r->proven = data & DATA_PROVEN;
+        r->engine = DATA_ENGINE(data);
+        atomic_long_inc(&n_hits);
+        return true;
+    }
+    return false;
+}
+
+/* How much an entry is worth keeping: any entry of an older game goes
+ * before the ones of a newer game, then the least proven and least costly.
+ */
+static u64 keep_priority(u64 data)
+{
+    if (!(data & DATA_VALID))
+        return 0;
+    return (u64) (0xff - (u8) (generation - DATA_GENERATION(data))) << 32 |
+           !!(data & DATA_PROVEN) << 16 | DATA_EFFORT(data);
+}
+
+void poscache_store(const char *table,
+                    char player,
+                    const struct poscache_result *r)
+{
+    struct poscache_entry *b, *victim = NULL;
+    struct poscache_key k;
+    int sym;
+
+    if (!cache || !READ_ONCE(use_cache) || r->move < 0)
+        return;
+    poscache_key_init(&k, table, player);
+    u64 key = canonical_key(&k, &sym);
+    u64 data = sym_map[sym][r->move] |
+               (u64) (u16) clamp_t(int, r->value, S16_MIN, S16_MAX) << 8 |
+               (u64) min(r->depth, 0xff) << 24 | DATA_VALID |
+               (r->proven ? DATA_PROVEN : 0) | (u64) r->engine << 36 |
+               (u64) READ_ONCE(generation) << 40 |
+               (u64) min(r->effort >> EFFORT_SHIFT, 0xffffU) << 48;
+
+    b = bucket(key);
+    for (int w = 0; w < POSCACHE_WAYS; w++) {
+        u64 old = READ_ONCE(b[w].data);
+        if ((old & DATA_VALID) && (READ_ONCE(b[w].check) ^ old) == key) {
+            /* A proven result is only replaced by another one */
+            if ((old & DATA_PROVEN) && !r->proven)
+                return;
+            victim = &b[w];
+            break;
+        }
+        if (!victim || keep_priority(old) < keep_priority(victim->data))
+            victim = &b[w];
+    }
+
+    u64 old = READ_ONCE(victim->data);
+    if (!(old & DATA_VALID))
+        atomic_long_inc(&n_used);
+    else if ((READ_ONCE(victim->check) ^ old) != key)
+        atomic_long_inc(&n_evictions);
+    WRITE_ONCE(victim->data, data);
+    WRITE_ONCE(victim->check, key ^ data);
+    atomic_long_inc(&n_stores);
+}
+
+void poscache_new_game(void)
+{
+    WRITE_ONCE(generation, generation + 1);
+}
+
+/* Drops every entry, once they no longer match the evaluation */
+void poscache_clear(void)
+{
+    if (!cache)
+        return;
+    memset(cache, 0, sizeof(*cache) << cache_bits);
+    atomic_long_set(&n_used, 0);
+}
+
+int poscache_stats(char *buf, size_t size)
+{
+    return scnprintf(buf, size,
+                     "entries %ld/%llu bytes %llu probes %ld hits %ld "
+                     "stores %ld evictions %ld\n",
+                     atomic_long_read(&n_used), cache_mask + 1,
+                     (cache_mask + 1) * sizeof(*cache),
+                     atomic_long_read(&n_probes), atomic_long_read(&n_hits),
+                     atomic_long_read(&n_stores),
+                     atomic_long_read(&n_evictions));
+}
+
+int poscache_init(void)
+{
+    cache_bits =
+        clamp_t(unsigned int, cache_bits, POSCACHE_MIN_BITS, POSCACHE_MAX_BITS);
+    cache = vzalloc_node(sizeof(*cache) << cache_bits, huge_numa_node());
+    if (!cache)
+        return -ENOMEM;
+    cache_mask = (1ULL << cache_bits) - 1;
+    return 0;
+}
+
+void poscache_exit(void)
+{
+    vfree(cache);
+    cache = NULL;
+}
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <linux/types.h>
+
+/* Results shared by every game and both engines, kept across games in a
+ * table of bounded size. A position is keyed by the smallest of its Zobrist
+ * keys over the symmetries of the board, so that a result found once holds
+ * for all its orientations.
+ *
+ * An entry is two words, the key XOR the data and the data, written without
+ * a lock: a reader that catches a half-written entry sees a wrong key and
+ * treats it as a miss.
+ */
+enum poscache_engine {
+    POSCACHE_TSS,
+    POSCACHE_NEGAMAX,
+    POSCACHE_MCTS,
+};
+
+/* value is from the perspective of the player to move, in the units of the
+ * engine: evaluation units for negamax, per mille of the root visits for
+ * MCTS. A proven result is found by an exhaustive negamax search, or is a
+ * forced win of threat-space search, which carries no value.
+ */
+struct poscache_result {
+    int move;
+    int value;
+    int depth; /* plies searched by negamax */
+    unsigned int effort; /* nodes or iterations spent */
+    bool proven;
+    enum poscache_engine engine;
+};
+
+/* Keys of a position under every symmetry, kept up to date by a search as
+ * it plays stones, so that it probes without rehashing the board.
+ */
+struct poscache_key {
+    u64 keys[8];
+};
+
+int poscache_init(void);
+void poscache_exit(void);
+void poscache_new_game(void);
+void poscache_clear(void);
+void poscache_key_init(struct poscache_key *k, const char *table, char player);
+void poscache_key_play(struct poscache_key *k, int grid, char player);
+bool poscache_probe(const char *table, char player, struct poscache_result *r);
+bool poscache_probe_key(const struct poscache_key *k,
+                        const char *table,
+                        struct poscache_result *r);
+void poscache_store(const char *table,
+                    char player,
+                    const struct poscache_result *r);
+int poscache_stats(char *buf, size_t size);
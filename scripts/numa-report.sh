@@ -0,0 +1,71 @@
+#!/bin/sh
+
+# Plays one game with the searches bound to each online NUMA node in turn and
+# reports, per move of negamax, the loads it served from another node and its
+# dTLB load misses, "-" where none were counted as on a CPU without the
+# events, and the mean time of a move of both engines. A machine with one
+# node can be split for the comparison by booting it with numa=fake=2.
+#
+# Usage: sudo scripts/numa-report.sh [transposition table size in MiB]
+
+MODULE=${MODULE:-./kmldrv.ko}
+TT_MB=${1:-256}
+NODES=$(cat /sys/devices/system/node/online)
+
+if ! test -f "$MODULE"; then
+    echo "Build $MODULE first, or set MODULE to its path."
+    exit 1
+fi
+
+# Expands a node list such as "0-1,3"
+nodes=$(echo "$NODES" | tr ',' '\n' | while IFS=- read -r first last; do
+    seq "$first" "${last:-$first}"
+done)
+
+rmmod kmldrv 2>/dev/null
+printf "%5s %14s %14s %12s %12s %6s\n" "node" "remote/move" \
+    "dTLB miss/move" "negamax usec" "MCTS usec" "moves"
+for node in $nodes; do
+    dmesg -C
+    insmod "$MODULE" search_node="$node" tt_size_mb="$TT_MB" search_stats=1 ||
+        exit 1
+    cat /dev/kmldrv >/dev/null &
+    reader=$!
+    until dmesg | grep -q "kmldrv: the engines held"; do
+        sleep 1
+    done
+    kill $reader
+    wait $reader 2>/dev/null
+    rmmod kmldrv
+
+    dmesg | awk -v node="$node" '
+        / searches run on NUMA node / {
+            node = $NF
+        }
+        / dTLB load misses, / {
+            for (i = 1; i < NF; i++) {
+                if ($(i + 1) == "dTLB")
+                    misses += $i
+                if ($(i + 1) == "remote")
+                    remote += $i
+            }
+            searches++
+        }
+        / end doing ai_two_work_func for / {
+            negamax += $(NF - 1)
+            negamax_moves++
+        }
+        / doing ai_one_work_func for / {
+            mcts += $(NF - 1)
+            mcts_moves++
+        }
+        function mean(sum, n) {
+            return sum && n ? sprintf("%.0f", sum / n) : "-"
+        }
+        END {
+            printf "%5s %14s %14s %12s %12s %6d\n", node,
+                mean(remote, searches), mean(misses, searches),
+                mean(negamax, negamax_moves), mean(mcts, mcts_moves),
+                searches
+        }'
+done
@@ -0,0 +1,21 @@
+#!/bin/sh
+
+# Loads the module with select_bench=1 and reports how many UCT selections
+# per second MCTS makes on a node of 16, 64 and 225 children, with random
+# statistics. Compare builds on the same machine, with the same CPU frequency
+# settings, over several runs.
+#
+# Usage: sudo scripts/select-bench.sh
+
+MODULE=${MODULE:-./kmldrv.ko}
+
+if ! test -f "$MODULE"; then
+    echo "Build $MODULE first, or set MODULE to its path."
+    exit 1
+fi
+
+rmmod kmldrv 2>/dev/null
+dmesg -C
+insmod "$MODULE" select_bench=1 || exit 1
+rmmod kmldrv
+dmesg | grep "selections/sec" | sed 's/.*\[MCTS\] //'
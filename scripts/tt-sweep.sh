@@ -0,0 +1,57 @@
+#!/bin/sh
+
+# Plays one game for each transposition table size and reports how many nodes
+# negamax searched per move at the given depth, fewer meaning more hits, and
+# how many dTLB load misses a move took, "-" where the CPU does not count them.
+# Games differ by the randomness of MCTS, so compare sizes over several runs.
+#
+# Usage: sudo scripts/tt-sweep.sh [depth] [size in MiB]...
+
+MODULE=${MODULE:-./kmldrv.ko}
+DEPTH=${1:-6}
+[ $# -gt 0 ] && shift
+SIZES=${*:-1 4 16 64 256 1024}
+
+if ! test -f "$MODULE"; then
+    echo "Build $MODULE first, or set MODULE to its path."
+    exit 1
+fi
+
+rmmod kmldrv 2>/dev/null
+printf "%8s %14s %14s %6s\n" "MiB" "nodes/move" "dTLB miss/move" "moves"
+for mb in $SIZES; do
+    dmesg -C
+    insmod "$MODULE" tt_size_mb="$mb" search_stats=1 || exit 1
+    cat /dev/kmldrv >/dev/null &
+    reader=$!
+    until dmesg | grep -q "kmldrv: the engines held"; do
+        sleep 1
+    done
+    kill $reader
+    wait $reader 2>/dev/null
+    rmmod kmldrv
+
+    dmesg | awk -v mb="$mb" -v depth="$DEPTH" '
+        / MiB transposition table / {
+            for (i = 1; i < NF; i++)
+                if ($(i + 1) == "MiB")
+                    mb = $i
+        }
+        $0 ~ "\\[negamax\\] depth " depth ":" {
+            for (i = 1; i < NF; i++)
+                if ($(i + 1) == "nodes")
+                    nodes += $i
+            moves++
+        }
+        / dTLB load misses, / {
+            for (i = 1; i < NF; i++)
+                if ($(i + 1) == "dTLB")
+                    misses += $i
+            searches++
+        }
+        END {
+            tlb = misses && searches ? sprintf("%.0f", misses / searches) : "-"
+            printf "%8s %14.0f %14s %6d\n", mb, moves ? nodes / moves : 0,
+                tlb, moves
+        }'
+done
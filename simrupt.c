@@ -3,6 +3,7 @@
 
 #include <linux/cdev.h>
 #include <linux/circ_buf.h>
+#include <linux/cpumask.h>
 #include <linux/init.h>
 #include <linux/interrupt.h>
 #include <linux/kfifo.h>
@@ -13,9 +14,15 @@
 #include <linux/version.h>
 #include <linux/workqueue.h>
 
+#include "analysis.h"
 #include "game.h"
+#include "hugemem.h"
 #include "mcts.h"
+#include "mlp.h"
 #include "negamax.h"
+#include "poscache.h"
+#include "tree_dump.h"
+#include "util.h"
 
 MODULE_LICENSE("Dual MIT/GPL");
 MODULE_AUTHOR("National Cheng Kung University, Taiwan");
@@ -113,38 +120,148 @@ static DEFINE_MUTEX(producer_lock);
  */
 static DEFINE_MUTEX(consumer_lock);
 
+/* Pattern weights of the evaluation, as produced by kmldrv-tune. Searches run
+ * under producer_lock, so an update never lands in the middle of one.
+ */
+static ssize_t eval_weights_show(struct device *dev,
+                                 struct device_attribute *attr,
+                                 char *buf)
+{
+    const struct game_variant *v = READ_ONCE(game);
+    int len = 0;
+    for (int mask = 0; mask < n_patterns(v); mask++)
+        len += scnprintf(buf + len, PAGE_SIZE - len, "%d%c",
+                         v->pattern_weights[mask],
+                         mask == n_patterns(v) - 1 ? '\n' : ' ');
+    return len;
+}
+
+static ssize_t eval_weights_store(struct device *dev,
+                                  struct device_attribute *attr,
+                                  const char *buf,
+                                  size_t count)
+{
+    struct game_variant *v = READ_ONCE(game);
+    int weights[MAX_PATTERNS];
+    int n = 0, len;
+
+    while (n < n_patterns(v) &&
+           sscanf(buf, "%d%n", &weights[n], &len) == 1) {
+        buf += len;
+        n++;
+    }
+    /* An empty segment scores for neither player, which keeps the
+     * evaluation antisymmetric as negamax relies on.
+     */
+    if (n != n_patterns(v) || weights[0])
+        return -EINVAL;
+
+    mutex_lock(&producer_lock);
+    memcpy(v->pattern_weights, weights, n * sizeof(*weights));
+    pattern_table_update(v);
+    /* Both caches hold scores of the old weights, the transposition table
+     * is cleared by the next search.
+     */
+    poscache_clear();
+    negamax_new_game();
+    mutex_unlock(&producer_lock);
+    return count;
+}
+
+static DEVICE_ATTR_RW(eval_weights);
+
+/* Variant of the next game, as "board_size goal". The game in progress is
+ * never switched, timer_handler() picks the new variant up when the board is
+ * reset.
+ */
+static struct game_variant *next_game;
+
+static ssize_t variant_show(struct device *dev,
+                            struct device_attribute *attr,
+                            char *buf)
+{
+    const struct game_variant *v = READ_ONCE(next_game);
+    return scnprintf(buf, PAGE_SIZE, "%d %d\n", v->board_size, v->goal);
+}
+
+static ssize_t variant_store(struct device *dev,
+                             struct device_attribute *attr,
+                             const char *buf,
+                             size_t count)
+{
+    struct game_variant *v;
+    int board_size, goal;
+
+    if (sscanf(buf, "%d %d", &board_size, &goal) != 2)
+        return -EINVAL;
+    v = game_variant_find(board_size, goal);
+    if (!v)
+        return -EINVAL;
+    WRITE_ONCE(next_game, v);
+    return count;
+}
+
+static DEVICE_ATTR_RW(variant);
+
+/* Lines of the last move of each engine, see analysis_format() */
+static ssize_t analysis_show(struct device *dev,
+                             struct device_attribute *attr,
+                             char *buf)
+{
+    int len;
+
+    mutex_lock(&producer_lock);
+    len = analysis_format("mcts", mcts_analysis(), buf, PAGE_SIZE);
+    len += analysis_format("negamax", negamax_analysis(), buf + len,
+                           PAGE_SIZE - len);
+    mutex_unlock(&producer_lock);
+    return len;
+}
+
+static DEVICE_ATTR_RO(analysis);
+
+static ssize_t position_cache_show(struct device *dev,
+                                   struct device_attribute *attr,
+                                   char *buf)
+{
+    return poscache_stats(buf, PAGE_SIZE);
+}
+
+static DEVICE_ATTR_RO(position_cache);
+
 /* We use an additional "faster" circular buffer to quickly store data from
  * interrupt context, before adding them to the kfifo.
  */
 static struct circ_buf fast_buf;
 
 static unsigned long mcts_avennode[3];
-static char table[N_GRIDS];
+static char table[MAX_GRIDS];
 
 /* Draw the board into draw_buffer */
 static int draw_board(char *table)
 {
     int i = 0, k = 0;
+    const int board_size = READ_ONCE(game)->board_size;
     draw_buffer[i++] = '\n';
     smp_wmb();
     draw_buffer[i++] = '\n';
     smp_wmb();
 
-    while (i < DRAWBUFFER_SIZE) {
-        for (int j = 0; j < (BOARD_SIZE << 1) - 1 && k < N_GRIDS; j++) {
+    for (int row = 0; row < board_size; row++) {
+        for (int j = 0; j < (board_size << 1) - 1; j++) {
             draw_buffer[i++] = j & 1 ? '|' : table[k++];
             smp_wmb();
         }
         draw_buffer[i++] = '\n';
         smp_wmb();
-        for (int j = 0; j < (BOARD_SIZE << 1) - 1; j++) {
+        for (int j = 0; j < (board_size << 1) - 1; j++) {
             draw_buffer[i++] = '-';
             smp_wmb();
         }
         draw_buffer[i++] = '\n';
         smp_wmb();
     }
-
+    memset(draw_buffer + i, 0, DRAWBUFFER_SIZE - i);
 
     return 0;
 }
@@ -222,10 +339,16 @@ static void ai_one_work_func(struct work_struct *w)
     WARN_ON_ONCE(in_softirq());
     WARN_ON_ONCE(in_interrupt());
 
+    /* Patching and preparing sleep, so they are done before get_cpu()
+     * disables preemption.
+     */
+    game_ops_select();
+    playout_rng_select();
+    mutex_lock(&producer_lock);
+    mcts_prepare();
     cpu = get_cpu();
     pr_info("kmldrv: [CPU#%d] start doing %s\n", cpu, __func__);
     tv_start = ktime_get();
-    mutex_lock(&producer_lock);
     int move;
     WRITE_ONCE(move, mcts(table, 'O'));
 
@@ -244,6 +367,7 @@ static void ai_one_work_func(struct work_struct *w)
     pr_info("kmldrv: [CPU#%d] doing %s for %llu usec\n", cpu, __func__,
             (unsigned long long) nsecs >> 10);
     put_cpu();
+    mcts_finish();
 }
 
 static void ai_two_work_func(struct work_struct *w)
@@ -256,12 +380,17 @@ static void ai_two_work_func(struct work_struct *w)
     WARN_ON_ONCE(in_softirq());
     WARN_ON_ONCE(in_interrupt());
 
+    /* Patching and preparing sleep, so they are done before get_cpu()
+     * disables preemption.
+     */
+    game_ops_select();
+    mutex_lock(&producer_lock);
+    negamax_prepare();
     cpu = get_cpu();
     pr_info("kmldrv: [CPU#%d] start doing %s\n", cpu, __func__);
     tv_start = ktime_get();
-    mutex_lock(&producer_lock);
     int move;
-    WRITE_ONCE(move, negamax_predict(table, 'X').move);
+    WRITE_ONCE(move, negamax_predict(table, 'X', delay).move);
 
     smp_mb();
 
@@ -278,11 +407,17 @@ static void ai_two_work_func(struct work_struct *w)
     pr_info("kmldrv: [CPU#%d] end doing %s for %llu usec\n", cpu, __func__,
             (unsigned long long) nsecs >> 10);
     put_cpu();
+    negamax_finish();
 }
 
 /* Workqueue for asynchronous bottom-half processing */
 static struct workqueue_struct *kmldrv_workqueue;
 
+/* Workqueue of the searches, bound to CPUs: an unbound one only takes the
+ * node of queue_work_node() as a hint, and may run them on another node.
+ */
+static struct workqueue_struct *search_workqueue;
+
 /* Work item: holds a pointer to the function that is going to be executed
  * asynchronously.
  */
@@ -291,6 +426,22 @@ static DECLARE_WORK(ai_one_work, ai_one_work_func);
 static DECLARE_WORK(ai_two_work, ai_two_work_func);
 static DECLARE_WORK(mcts_calc_load_work, mcts_calc_load);
 
+/* A CPU of the node holding the search tables, see huge_numa_init(), this
+ * one if it belongs to the node. The searches are serialized, so that one
+ * CPU serves both engines. Without an online CPU on the node, the searches
+ * stay on this one.
+ */
+static int search_cpu(void)
+{
+    const struct cpumask *mask = cpumask_of_node(huge_numa_node());
+    unsigned int cpu = smp_processor_id();
+
+    if (cpumask_test_cpu(cpu, mask))
+        return cpu;
+    cpu = cpumask_any_and(mask, cpu_online_mask);
+    return cpu < nr_cpu_ids ? cpu : smp_processor_id();
+}
+
 /* Tasklet handler.
  *
  * NOTE: different tasklets can run concurrently on different processors, but
@@ -311,14 +462,15 @@ static void game_tasklet_func(unsigned long __data)
     READ_ONCE(turn);
     smp_rmb();
 
+    /* The searches run next to their tables */
     if (finish && turn == 'O') {
         WRITE_ONCE(finish, 0);
         smp_wmb();
-        queue_work(kmldrv_workqueue, &ai_one_work);
+        queue_work_on(search_cpu(), search_workqueue, &ai_one_work);
     } else if (finish && turn == 'X') {
         WRITE_ONCE(finish, 0);
         smp_wmb();
-        queue_work(kmldrv_workqueue, &ai_two_work);
+        queue_work_on(search_cpu(), search_workqueue, &ai_two_work);
     }
     queue_work(kmldrv_workqueue, &mcts_calc_load_work);
     queue_work(kmldrv_workqueue, &drawboard_work);
@@ -364,6 +516,10 @@ static void timer_handler(struct timer_list *__timer)
         ai_game();
         mod_timer(&timer, jiffies + msecs_to_jiffies(delay));
     } else {
+        /* No search runs once the game is decided */
+        pr_info("kmldrv: the engines held %zu KiB at most during the game\n",
+                game_arena_end() >> 10);
+
         read_lock(&attr_obj.lock);
         if (attr_obj.display == '1') {
             int cpu = get_cpu();
@@ -383,8 +539,11 @@ static void timer_handler(struct timer_list *__timer)
         }
 
         if (attr_obj.end == '0') {
-            memset(table, ' ',
-                   N_GRIDS); /* Reset the table so the game restart */
+            /* Reset the table so the game restart, in the variant asked for */
+            WRITE_ONCE(game, READ_ONCE(next_game));
+            memset(table, ' ', MAX_GRIDS);
+            poscache_new_game();
+            negamax_new_game();
             mod_timer(&timer, jiffies + msecs_to_jiffies(delay));
         }
 
@@ -453,10 +612,14 @@ static int kmldrv_open(struct inode *inode, struct file *filp)
 static int kmldrv_release(struct inode *inode, struct file *filp)
 {
     pr_debug("kmldrv: %s\n", __func__);
-    if (atomic_dec_and_test(&open_cnt) == 0) {
+    /* The last reader gone, the game stops and its memory goes */
+    if (atomic_dec_and_test(&open_cnt)) {
         del_timer_sync(&timer);
+        tasklet_kill(&game_tasklet);
+        flush_workqueue(search_workqueue);
         flush_workqueue(kmldrv_workqueue);
         fast_buf_clear();
+        game_arena_end();
     }
     pr_info("release, current cnt: %d\n", atomic_read(&open_cnt));
 
@@ -515,9 +678,39 @@ static int __init kmldrv_init(void)
         goto error_cdev;
     }
 
+    ret = device_create_file(kmldrv_dev, &dev_attr_eval_weights);
+    if (ret < 0) {
+        printk(KERN_ERR "failed to create sysfs file eval_weights\n");
+        goto error_cdev;
+    }
+
+    next_game = game;
+    ret = device_create_file(kmldrv_dev, &dev_attr_variant);
+    if (ret < 0) {
+        printk(KERN_ERR "failed to create sysfs file variant\n");
+        goto error_cdev;
+    }
+
+    ret = device_create_file(kmldrv_dev, &dev_attr_analysis);
+    if (ret < 0) {
+        printk(KERN_ERR "failed to create sysfs file analysis\n");
+        goto error_cdev;
+    }
+
+    ret = device_create_file(kmldrv_dev, &dev_attr_position_cache);
+    if (ret < 0) {
+        printk(KERN_ERR "failed to create sysfs file position_cache\n");
+        goto error_cdev;
+    }
+
+    /* The network evaluator is optional, engines fall back without it */
+    if (!mlp_load(kmldrv_dev))
+        mlp_benchmark();
+
     /* Allocate fast circular buffer */
     fast_buf.buf = vmalloc(PAGE_SIZE);
     if (!fast_buf.buf) {
+        mlp_unload();
         device_destroy(kmldrv_class, dev_id);
         class_destroy(kmldrv_class);
         ret = -ENOMEM;
@@ -527,6 +720,7 @@ static int __init kmldrv_init(void)
     /* Create the workqueue */
     kmldrv_workqueue = alloc_workqueue("kmldrvd", WQ_UNBOUND, WQ_MAX_ACTIVE);
     if (!kmldrv_workqueue) {
+        mlp_unload();
         vfree(fast_buf.buf);
         device_destroy(kmldrv_class, dev_id);
         class_destroy(kmldrv_class);
@@ -534,9 +728,40 @@ static int __init kmldrv_init(void)
         goto error_cdev;
     }
 
+    /* A search holds its CPU for the whole move */
+    search_workqueue =
+        alloc_workqueue("kmldrvd_search", WQ_CPU_INTENSIVE, WQ_MAX_ACTIVE);
+    if (!search_workqueue) {
+        destroy_workqueue(kmldrv_workqueue);
+        mlp_unload();
+        vfree(fast_buf.buf);
+        device_destroy(kmldrv_class, dev_id);
+        class_destroy(kmldrv_class);
+        ret = -ENOMEM;
+        goto error_cdev;
+    }
+
+    huge_numa_init();
+    ret = game_arena_init();
+    if (ret) {
+        destroy_workqueue(search_workqueue);
+        destroy_workqueue(kmldrv_workqueue);
+        mlp_unload();
+        vfree(fast_buf.buf);
+        device_destroy(kmldrv_class, dev_id);
+        class_destroy(kmldrv_class);
+        goto error_cdev;
+    }
+
+    game_init();
     negamax_init();
     mcts_init();
-    memset(table, ' ', N_GRIDS);
+    mcts_benchmark();
+    tree_dump_init();
+    /* Games are played as well without the cache, only slower */
+    if (poscache_init())
+        pr_warn("kmldrv: no memory for the position cache\n");
+    memset(table, ' ', MAX_GRIDS);
     turn = 'O';
     finish = 1;
 
@@ -566,8 +791,14 @@ static void __exit kmldrv_exit(void)
 
     del_timer_sync(&timer);
     tasklet_kill(&game_tasklet);
+    flush_workqueue(search_workqueue);
+    destroy_workqueue(search_workqueue);
     flush_workqueue(kmldrv_workqueue);
     destroy_workqueue(kmldrv_workqueue);
+    tree_dump_exit();
+    poscache_exit();
+    negamax_exit();
+    game_arena_exit();
     vfree(fast_buf.buf);
     device_destroy(kmldrv_class, dev_id);
     class_destroy(kmldrv_class);
@@ -575,6 +806,7 @@ static void __exit kmldrv_exit(void)
     unregister_chrdev_region(dev_id, NR_KMLDRV);
 
     kfifo_free(&rx_fifo);
+    mlp_unload();
     pr_info("kmldrv: unloaded\n");
 }
 
@@ -0,0 +1,54 @@
+#include <linux/err.h>
+#include <linux/perf_event.h>
+#include <linux/sched.h>
+
+#include "tlbstat.h"
+
+#ifdef CONFIG_PERF_EVENTS
+/* Read misses of the given cache of the hardware */
+static struct perf_event *cache_counter(u64 cache)
+{
+    struct perf_event_attr attr = {
+        .type = PERF_TYPE_HW_CACHE,
+        .size = sizeof(attr),
+        .config = cache | PERF_COUNT_HW_CACHE_OP_READ << 8 |
+                  PERF_COUNT_HW_CACHE_RESULT_MISS << 16,
+        .pinned = 1,
+    };
+    struct perf_event *event =
+        perf_event_create_kernel_counter(&attr, -1, current, NULL, NULL);
+
+    return IS_ERR(event) ? NULL : event;
+}
+
+static u64 counter_release(struct perf_event *event)
+{
+    u64 count, enabled, running;
+
+    if (!event)
+        return 0;
+    count = perf_event_read_value(event, &enabled, &running);
+    perf_event_release_kernel(event);
+    return count;
+}
+#endif
+
+void tlb_counter_start(struct tlb_counter *c)
+{
+    c->dtlb = c->remote = NULL;
+#ifdef CONFIG_PERF_EVENTS
+    c->dtlb = cache_counter(PERF_COUNT_HW_CACHE_DTLB);
+    /* A miss of the node cache is a load from another node */
+    c->remote = cache_counter(PERF_COUNT_HW_CACHE_NODE);
+#endif
+}
+
+void tlb_counter_stop(struct tlb_counter *c, struct tlb_counts *counts)
+{
+    counts->dtlb_misses = counts->remote_loads = 0;
+#ifdef CONFIG_PERF_EVENTS
+    counts->dtlb_misses = counter_release(c->dtlb);
+    counts->remote_loads = counter_release(c->remote);
+    c->dtlb = c->remote = NULL;
+#endif
+}
@@ -0,0 +1,21 @@
+#pragma once
+
+#include <linux/types.h>
+
+/* Data TLB load misses of the calling task, and its loads served by the
+ * memory of another NUMA node, for measuring how the layout and placement of
+ * the search tables pay off. Without perf events, or on a CPU that does not
+ * count them, the counters read 0.
+ */
+struct tlb_counter {
+    struct perf_event *dtlb;
+    struct perf_event *remote;
+};
+
+struct tlb_counts {
+    u64 dtlb_misses;
+    u64 remote_loads;
+};
+
+void tlb_counter_start(struct tlb_counter *c);
+void tlb_counter_stop(struct tlb_counter *c, struct tlb_counts *counts);
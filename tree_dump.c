@@ -0,0 +1,105 @@
+#include <linux/debugfs.h>
+#include <linux/fs.h>
+#include <linux/spinlock.h>
+#include <linux/vmalloc.h>
+
+#include "tree_dump.h"
+
+/* The last snapshot, swapped under dump_lock. A reader holds a reference
+ * for as long as the file is open, so the search publishing the next one
+ * never waits on a read.
+ */
+static struct tree_dump *current_dump;
+static DEFINE_SPINLOCK(dump_lock);
+static struct dentry *dump_dir;
+
+struct tree_dump *tree_dump_alloc(unsigned int n_nodes)
+{
+    struct tree_dump *dump = vzalloc(struct_size(dump, nodes, n_nodes));
+
+    if (!dump)
+        return NULL;
+    kref_init(&dump->ref);
+    return dump;
+}
+
+static void tree_dump_free(struct kref *ref)
+{
+    vfree(container_of(ref, struct tree_dump, ref));
+}
+
+void tree_dump_put(struct tree_dump *dump)
+{
+    kref_put(&dump->ref, tree_dump_free);
+}
+
+void tree_dump_publish(struct tree_dump *dump)
+{
+    struct tree_dump *old;
+
+    if (dump)
+        dump->size = sizeof(dump->header) +
+                     dump->header.n_nodes * sizeof(*dump->nodes);
+    spin_lock(&dump_lock);
+    old = current_dump;
+    current_dump = dump;
+    spin_unlock(&dump_lock);
+    if (old)
+        tree_dump_put(old);
+}
+
+static int tree_dump_open(struct inode *inode, struct file *file)
+{
+    struct tree_dump *dump;
+
+    spin_lock(&dump_lock);
+    dump = current_dump;
+    if (dump)
+        kref_get(&dump->ref);
+    spin_unlock(&dump_lock);
+    if (!dump)
+        return -ENODATA;
+    file->private_data = dump;
+    return 0;
+}
+
+static ssize_t tree_dump_read(struct file *file,
+                              char __user *buf,
+                              size_t count,
+                              loff_t *ppos)
+{
+    struct tree_dump *dump = file->private_data;
+
+    return simple_read_from_buffer(buf, count, ppos, &dump->header,
+                                   dump->size);
+}
+
+static int tree_dump_release(struct inode *inode, struct file *file)
+{
+    struct tree_dump *dump = file->private_data;
+
+    tree_dump_put(dump);
+    return 0;
+}
+
+static const struct file_operations tree_dump_fops = {
+    .owner = THIS_MODULE,
+    .open = tree_dump_open,
+    .read = tree_dump_read,
+    .release = tree_dump_release,
+    .llseek = default_llseek,
+};
+
+/* Without debugfs the snapshots are simply never read */
+void tree_dump_init(void)
+{
+    dump_dir = debugfs_create_dir(TREE_DUMP_DIR, NULL);
+    debugfs_create_file(TREE_DUMP_NAME, 0400, dump_dir, NULL,
+                        &tree_dump_fops);
+}
+
+void tree_dump_exit(void)
+{
+    debugfs_remove_recursive(dump_dir);
+    tree_dump_publish(NULL);
+}
@@ -0,0 +1,68 @@
+#pragma once
+
+#ifdef __KERNEL__
+#include <linux/kref.h>
+#include <linux/types.h>
+#else
+#include <stdint.h>
+typedef uint8_t u8;
+typedef uint16_t u16;
+typedef uint32_t u32;
+#define __packed __attribute__((packed))
+#endif
+
+/* Snapshot of the MCTS tree of the last move, as read from the debugfs file
+ * TREE_DUMP_FILE and converted by kmldrv-tree. It is the header followed by
+ * the nodes in preorder, each with the number of its children that follow,
+ * in the byte order of the machine that ran the search.
+ *
+ * The subtree is cut below the module parameter tree_dump_depth, at most
+ * MAX_PV_LENGTH, at the children with fewer than tree_dump_visits visits, and
+ * after TREE_DUMP_MAX_NODES nodes.
+ */
+#define TREE_DUMP_DIR "kmldrv"
+#define TREE_DUMP_NAME "mcts_tree"
+#define TREE_DUMP_FILE "/sys/kernel/debug/" TREE_DUMP_DIR "/" TREE_DUMP_NAME
+#define TREE_DUMP_MAGIC 0x5452434bU /* "KCRT" */
+#define TREE_DUMP_VERSION 1
+#define TREE_DUMP_MAX_NODES (1 << 16)
+#define TREE_DUMP_NO_MOVE 0xff /* move of the root */
+
+struct tree_dump_header {
+    u32 magic;
+    u16 version;
+    u8 board_size;
+    u8 player; /* to move at the root */
+    u8 scale_bits; /* fractional bits of score and prior */
+    u8 reserved[3];
+    u32 n_nodes;
+} __packed;
+
+/* score is the sum of the values backed up through the node, from the
+ * perspective of the player who moved into it. result is 'O' or 'X' for a
+ * won game, 'D' for a draw, and ' ' while the game goes on.
+ */
+struct tree_dump_node {
+    u8 move;
+    u8 result;
+    u16 n_children;
+    u32 n_visits;
+    u32 score;
+    u32 prior;
+} __packed;
+
+#ifdef __KERNEL__
+struct tree_dump {
+    struct kref ref;
+    size_t size; /* of header and nodes */
+    struct tree_dump_header header;
+    struct tree_dump_node nodes[];
+};
+
+/* Room for n_nodes, of which tree_dump_publish() exposes header.n_nodes */
+struct tree_dump *tree_dump_alloc(unsigned int n_nodes);
+void tree_dump_publish(struct tree_dump *dump);
+void tree_dump_put(struct tree_dump *dump);
+void tree_dump_init(void);
+void tree_dump_exit(void);
+#endif
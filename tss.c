@@ -0,0 +1,227 @@
+#include <linux/moduleparam.h>
+#include <linux/printk.h>
+#include <linux/string.h>
+
+#include "game.h"
+#include "tss.h"
+
+static bool use_tss = true;
+module_param(use_tss, bool, 0644);
+MODULE_PARM_DESC(use_tss, "Play forced wins found by threat-space search");
+
+/* Searches run under producer_lock, one at a time, so the state is shared.
+ * The move lists of vcf() and vct() are too large for the kernel stack and
+ * are kept here per remaining depth, only one line of fours being searched
+ * at a time.
+ */
+static struct {
+    char table[MAX_GRIDS];
+    struct movegen mg;
+    unsigned char count[2][MAX_SEGMENTS]; /* stones of 'O' and 'X' */
+    unsigned char flanked[2][MAX_SEGMENTS]; /* flanking stones, exact rule */
+    int n_nodes;
+    int vcf_moves[TSS_VCF_DEPTH + 1][MAX_GRIDS];
+    int vct_moves[TSS_VCT_DEPTH + 1][MAX_GRIDS];
+    int vct_replies[TSS_VCT_DEPTH + 1][MAX_GRIDS];
+} tss;
+
+static inline char stone(int p)
+{
+    return p ? 'X' : 'O';
+}
+
+static void tss_count(int move, int p, int d)
+{
+    for (int i = 0; i < game->n_grid_segments[move]; i++)
+        tss.count[p][game->grid_segments[move][i].segment] += d;
+    for (int i = 0; !ALLOW_EXCEED && i < game->n_grid_flanks[move]; i++)
+        tss.flanked[p][game->grid_flanks[move][i]] += d;
+}
+
+static void tss_play(int move, int p)
+{
+    tss.table[move] = stone(p);
+    movegen_play(&tss.mg, move, stone(p));
+    tss_count(move, p, 1);
+}
+
+static void tss_undo(int move, int p)
+{
+    tss.table[move] = ' ';
+    movegen_undo(&tss.mg, move, stone(p));
+    tss_count(move, p, -1);
+}
+
+/* Whether segment s holds n stones of p and none of the opponent, and can
+ * still become a line of exactly goal stones of p.
+ */
+static inline bool open_segment(int s, int p, int n)
+{
+    return tss.count[p][s] == n && !tss.count[!p][s] &&
+           (ALLOW_EXCEED || !tss.flanked[p][s]);
+}
+
+/* Stores up to max distinct grids where p completes a line into cells */
+static int gain_cells(int p, int *cells, int max)
+{
+    int n = 0;
+    for (int s = 0; s < game->n_segments && n < max; s++) {
+        if (!open_segment(s, p, game->goal - 1))
+            continue;
+        for (int k = 0; k < game->goal; k++) {
+            int grid = game->segments[s].grids[k];
+            if (tss.table[grid] == ' ' && (!n || cells[0] != grid))
+                cells[n++] = grid;
+        }
+    }
+    return n;
+}
+
+/* Adds the empty grids of the segments open for p with n stones */
+static void add_segment_cells(bitboard_t *cells, int p, int n)
+{
+    for (int s = 0; s < game->n_segments; s++) {
+        if (!open_segment(s, p, n))
+            continue;
+        for (int k = 0; k < game->goal; k++) {
+            int grid = game->segments[s].grids[k];
+            if (tss.table[grid] == ' ')
+                bb_set(cells, grid);
+        }
+    }
+}
+
+static int bb_to_moves(const bitboard_t *cells, int *moves)
+{
+    int n = 0;
+    for (int w = 0; w < BITBOARD_WORDS(game->n_grids); w++)
+        for (unsigned long long x = cells->w[w]; x; x &= x - 1)
+            moves[n++] = (w << 6) + __builtin_ctzll(x);
+    return n;
+}
+
+/* Number of fours attacker a needs to win, 0 without a win in depth fours.
+ * The first of them is stored into *move.
+ */
+static int vcf(int a, int depth, int *move)
+{
+    int cells[2], *moves = tss.vcf_moves[depth];
+    bitboard_t fours;
+
+    if (++tss.n_nodes > TSS_MAX_NODES)
+        return 0;
+    if (gain_cells(a, cells, 1)) {
+        *move = cells[0];
+        return 1;
+    }
+    /* Two fours of the defender cannot both be blocked */
+    int n_threats = gain_cells(!a, cells, 2);
+    if (!depth || n_threats > 1)
+        return 0;
+
+    bb_clear(&fours, BITBOARD_WORDS(BITBOARD_BITS));
+    add_segment_cells(&fours, a, game->goal - 2);
+    int n_moves = bb_to_moves(&fours, moves);
+    for (int i = 0; i < n_moves; i++) {
+        int gains[2], n_wins = 0, reply;
+        /* A four of the defender has to be blocked by ours */
+        if (n_threats && moves[i] != cells[0])
+            continue;
+        tss_play(moves[i], a);
+        if (gain_cells(a, gains, 2) > 1) {
+            n_wins = 2;
+        } else {
+            tss_play(gains[0], !a);
+            if (GAME_OP(check_move_win)(tss.table, gains[0]) == ' ') {
+                n_wins = vcf(a, depth - 1, &reply);
+                if (n_wins)
+                    n_wins++;
+            }
+            tss_undo(gains[0], !a);
+        }
+        tss_undo(moves[i], a);
+        if (n_wins) {
+            *move = moves[i];
+            return n_wins;
+        }
+    }
+    return 0;
+}
+
+/* Same as vcf() with up to depth threes mixed into the fours */
+static int vct(int a, int depth, int *move)
+{
+    int cells[2], *moves = tss.vct_moves[depth];
+    int *replies = tss.vct_replies[depth];
+    bitboard_t threats;
+    int n_wins = vcf(a, TSS_VCF_DEPTH, move);
+
+    if (n_wins || !depth || gain_cells(!a, cells, 1))
+        return n_wins;
+
+    bb_clear(&threats, BITBOARD_WORDS(BITBOARD_BITS));
+    add_segment_cells(&threats, a, game->goal - 3);
+    int n_moves = bb_to_moves(&threats, moves);
+    for (int i = 0; i < n_moves && tss.n_nodes <= TSS_MAX_NODES; i++) {
+        int reply;
+        tss_play(moves[i], a);
+        /* A three is only a threat if ignoring it loses to a VCF */
+        if (!vcf(a, TSS_VCF_DEPTH, &reply)) {
+            tss_undo(moves[i], a);
+            continue;
+        }
+
+        bitboard_t defence;
+        bb_clear(&defence, BITBOARD_WORDS(BITBOARD_BITS));
+        int n_replies = movegen_moves(&tss.mg, replies);
+        for (int r = 0; r < n_replies; r++)
+            bb_set(&defence, replies[r]);
+        add_segment_cells(&defence, a, game->goal - 3);
+        add_segment_cells(&defence, a, game->goal - 2);
+        add_segment_cells(&defence, !a, game->goal - 2);
+        n_replies = bb_to_moves(&defence, replies);
+
+        int longest = 0;
+        for (int r = 0; r < n_replies; r++) {
+            tss_play(replies[r], !a);
+            int n = vct(a, depth - 1, &reply);
+            tss_undo(replies[r], !a);
+            if (!n) {
+                longest = 0;
+                break;
+            }
+            if (n > longest)
+                longest = n;
+        }
+        tss_undo(moves[i], a);
+        if (longest) {
+            *move = moves[i];
+            return longest + 1;
+        }
+    }
+    return 0;
+}
+
+int tss_probe(const char *table, char player)
+{
+    int move = -1;
+
+    if (!use_tss || game->goal < TSS_MIN_GOAL)
+        return -1;
+
+    memcpy(tss.table, table, game->n_grids);
+    movegen_init(&tss.mg, table);
+    memset(tss.count, 0, sizeof(tss.count));
+    memset(tss.flanked, 0, sizeof(tss.flanked));
+    for (int i = 0; i < game->n_grids; i++)
+        if (table[i] != ' ')
+            tss_count(i, table[i] == 'X', 1);
+    tss.n_nodes = 0;
+
+    int n_moves = vct(player == 'X', TSS_VCT_DEPTH, &move);
+    if (!n_moves)
+        return -1;
+    pr_info("kmldrv: [TSS] %c wins in %d moves from %d, %d nodes\n", player,
+            n_moves, move, tss.n_nodes);
+    return move;
+}
@@ -0,0 +1,23 @@
+#pragma once
+
+#include "game.h"
+
+/* Threat-space search: looks for a forced win of the player to move by
+ * playing threats only, on the variants where a line takes at least
+ * TSS_MIN_GOAL stones.
+ *
+ * A four is a segment holding goal - 1 stones of the attacker and no stone
+ * of the defender, which the defender has to block on its last empty grid.
+ * The search first looks for a sequence of fours (VCF), then for sequences
+ * that also use threes, segments with goal - 2 stones of the attacker that
+ * win by a VCF if left alone (VCT). Against a three the defender tries every
+ * candidate move, its own fours and every empty grid of the open segments of
+ * the attacker, so a win found is forced within the candidate moves.
+ */
+#define TSS_MIN_GOAL 4
+#define TSS_VCF_DEPTH 16
+#define TSS_VCT_DEPTH 2
+#define TSS_MAX_NODES 50000
+
+/* Returns the first move of a forced win for player, or -1 */
+int tss_probe(const char *table, char player);
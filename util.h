@@ -2,45 +2,33 @@
 
 #include "game.h"
 
-static inline int eval_line_segment_score(const char *table,
-                                          char player,
-                                          int i,
-                                          int j,
-                                          line_t line)
+/* A line segment holding stones of one player only is worth the weight of
+ * its pattern, the mask of the occupied offsets along the segment. The
+ * default weights are 10^(k - 1) for k stones.
+ *
+ * pattern_score[own][opponent] folds the weights into one table indexed by
+ * the masks of both players, so that scoring a segment needs no branch. It is
+ * rebuilt by pattern_table_update() whenever pattern_weights[] changes. Both
+ * tables belong to a variant and hold n_patterns() entries per dimension.
+ */
+static inline int n_patterns(const struct game_variant *v)
 {
-    int score = 0;
-    for (int k = 0; k < GOAL; k++) {
-        char curr =
-            table[GET_INDEX(i + k * line.i_shift, j + k * line.j_shift)];
-        if (curr == player) {
-            if (score < 0)
-                return 0;
-            if (score)
-                score *= 10;
-            else
-                score = 1;
-        } else if (curr != ' ') {
-            if (score > 0)
-                return 0;
-            if (score)
-                score *= 10;
-            else
-                score = -1;
-        }
-    }
-    return score;
+    return 1 << v->goal;
 }
 
+void pattern_weights_reset(struct game_variant *v);
+void pattern_table_update(struct game_variant *v);
+
 static inline int get_score(const char *table, char player)
 {
-    int score = 0;
-    for (int i_line = 0; i_line < 4; ++i_line) {
-        line_t line = lines[i_line];
-        for (int i = line.i_lower_bound; i < line.i_upper_bound; ++i) {
-            for (int j = line.j_lower_bound; j < line.j_upper_bound; ++j) {
-                score += eval_line_segment_score(table, player, i, j, line);
-            }
-        }
-    }
-    return score;
+    return game->ops->get_score(table, player);
+}
+
+/* Change of get_score(table, player) when player puts a stone on the empty
+ * grid move. Only the segments through the move are rescored, which lets a
+ * search keep the score up to date across make/unmake.
+ */
+static inline int eval_move_delta(const char *table, int move, char player)
+{
+    return GAME_OP(eval_move_delta)(table, move, player);
 }
@@ -1,66 +1,185 @@
-#include <linux/slab.h>
+#include <linux/build_bug.h>
+#include <linux/limits.h>
+#include <linux/log2.h>
+#include <linux/moduleparam.h>
+#include <linux/printk.h>
+#include <linux/string.h>
 
+#include "hugemem.h"
 #include "wyhash.h"
 #include "zobrist.h"
 
-u64 zobrist_table[N_GRIDS][2];
+#define TT_MAX_SIZE_MB 1024
 
-#define HASH(key) ((key) % HASH_TABLE_SIZE)
+/* Plies of depth an entry loses, when it comes to replacing it, for each
+ * search since the one which stored it.
+ */
+#define TT_AGE_PLIES 4
 
-static struct hlist_head *hash_table;
+u64 zobrist_table[MAX_GRIDS][2];
+
+static unsigned int tt_size_mb = 4;
+module_param(tt_size_mb, uint, 0644);
+MODULE_PARM_DESC(tt_size_mb,
+                 "Size of the transposition table in MiB, rounded down to a "
+                 "power of two, changed at the next game");
+
+struct tt_bucket {
+    zobrist_entry_t entries[ZOBRIST_WAYS];
+    u32 unused;
+};
+
+static_assert(sizeof(struct tt_bucket) == 64);
+
+static struct huge_region tt_region;
+static struct tt_bucket *tt;
+static unsigned int tt_mb;
+static unsigned int tt_shift; /* 64 - log2 of the number of buckets */
+static u8 generation;
+static bool new_game;
+
+/* Empties the table, after replacing it by one of size_mb MiB, rounded down
+ * to a power of two, unless it has that size already.
+ */
+static void tt_alloc(unsigned int size_mb)
+{
+    size_mb = rounddown_pow_of_two(
+        clamp_t(unsigned int, size_mb, 1, TT_MAX_SIZE_MB));
+    if (tt && size_mb == tt_mb) {
+        memset(tt, 0, tt_region.size);
+        return;
+    }
+
+    /* Both tables may not fit at once */
+    huge_free(&tt_region);
+    tt = NULL;
+    if (huge_alloc(&tt_region, (size_t) size_mb << 20)) {
+        pr_warn("kmldrv: no memory for the transposition table\n");
+        return;
+    }
+    tt = tt_region.addr;
+    tt_mb = size_mb;
+    tt_shift = 64 - ilog2(tt_region.size / sizeof(*tt));
+    pr_info("kmldrv: %u MiB transposition table from %s\n", tt_mb,
+            huge_kind_name(&tt_region));
+}
 
 void zobrist_init(void)
 {
     int i;
-    for (i = 0; i < N_GRIDS; i++) {
+    for (i = 0; i < MAX_GRIDS; i++) {
         zobrist_table[i][0] = wyhash64();
         zobrist_table[i][1] = wyhash64();
     }
-    hash_table =
-        kmalloc(sizeof(struct hlist_head) * HASH_TABLE_SIZE, GFP_KERNEL);
-    if (!hash_table) {
-        pr_info("simrupt: Failed to allocate space for hash_table\n");
+    tt_alloc(tt_size_mb);
+}
+
+void zobrist_exit(void)
+{
+    huge_free(&tt_region);
+    tt = NULL;
+}
+
+/* Called at the end of a game, where no search runs */
+void zobrist_new_game(void)
+{
+    WRITE_ONCE(new_game, true);
+}
+
+/* Called before each search in process context, as clearing up to 1 GiB
+ * takes a while and resizing sleeps. The first search of a game starts from
+ * an empty table, resized if tt_size_mb has changed.
+ */
+void zobrist_prepare(void)
+{
+    if (!READ_ONCE(new_game))
         return;
-    }
-    for (i = 0; i < HASH_TABLE_SIZE; i++)
-        INIT_HLIST_HEAD(&hash_table[i]);
+    WRITE_ONCE(new_game, false);
+    tt_alloc(READ_ONCE(tt_size_mb));
 }
 
-zobrist_entry_t *zobrist_get(u64 key)
+/* Called at the start of each search, which keeps the entries of the earlier
+ * moves of the game.
+ */
+void zobrist_new_search(void)
 {
-    unsigned long long hash_key = HASH(key);
+    generation++;
+}
 
-    if (hlist_empty(&hash_table[hash_key]))
-        return NULL;
+u64 zobrist_key(const char *table)
+{
+    u64 key = 0;
+    for (int i = 0; i < game->n_grids; i++)
+        if (table[i] != ' ')
+            key ^= zobrist_table[i][table[i] == 'X'];
+    return key;
+}
 
-    zobrist_entry_t *entry = NULL;
+static zobrist_entry_t *bucket(u64 key)
+{
+    return tt[key >> tt_shift].entries;
+}
 
-    hlist_for_each_entry (entry, &hash_table[hash_key], ht_list) {
-        if (entry->key == key)
-            return entry;
-    }
+zobrist_entry_t *zobrist_get(u64 key)
+{
+    if (!tt)
+        return NULL;
+
+    zobrist_entry_t *b = bucket(key);
+    for (int w = 0; w < ZOBRIST_WAYS; w++)
+        if (b[w].check == (u32) key && b[w].depth)
+            return &b[w];
     return NULL;
 }
 
-void zobrist_put(u64 key, int score, int move)
+/* Whether entry was stored by the search of an earlier move */
+bool zobrist_reused(const zobrist_entry_t *entry)
+{
+    return entry->generation != generation;
+}
+
+/* Worth of keeping an entry, its depth less TT_AGE_PLIES for each search
+ * since it was stored, as the positions near the root of an earlier search
+ * are mostly out of reach of the current one.
+ */
+static int entry_worth(const zobrist_entry_t *entry)
 {
-    unsigned long long hash_key = HASH(key);
-    zobrist_entry_t *new_entry = kmalloc(sizeof(zobrist_entry_t), GFP_KERNEL);
-    new_entry->key = key;
-    new_entry->move = move;
-    new_entry->score = score;
-    hlist_add_head(&new_entry->ht_list, &hash_table[hash_key]);
+    if (!entry->depth)
+        return INT_MIN;
+    return entry->depth - TT_AGE_PLIES * (u8) (generation - entry->generation);
 }
 
-void zobrist_clear(void)
+/* A new search of a position already stored replaces its entry, otherwise
+ * the entry least worth keeping goes.
+ */
+void zobrist_put(u64 key,
+                 int score,
+                 int move,
+                 int depth,
+                 enum zobrist_bound bound)
 {
-    for (int i = 0; i < HASH_TABLE_SIZE; i++) {
-        while (!hlist_empty(&hash_table[i])) {
-            zobrist_entry_t *entry =
-                hlist_entry(hash_table[i].first, zobrist_entry_t, ht_list);
-            hlist_del(&entry->ht_list);
-            kfree(entry);
+    zobrist_entry_t *entry = NULL;
+
+    if (!tt)
+        return;
+
+    zobrist_entry_t *b = bucket(key);
+    int worth = INT_MAX;
+    for (int w = 0; w < ZOBRIST_WAYS; w++) {
+        if (b[w].check == (u32) key && b[w].depth) {
+            entry = &b[w];
+            break;
+        }
+        int v = entry_worth(&b[w]);
+        if (v < worth) {
+            entry = &b[w];
+            worth = v;
         }
-        INIT_HLIST_HEAD(&hash_table[i]);
     }
+    entry->check = key;
+    entry->score = score;
+    entry->move = move;
+    entry->depth = depth;
+    entry->bound = bound;
+    entry->generation = generation;
 }
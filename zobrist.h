@@ -1,21 +1,43 @@
 #pragma once
 
-#include <linux/list.h>
-
 #include "game.h"
 
-#define HASH_TABLE_SIZE (100003)
+/* Entries of a bucket share a cache line */
+#define ZOBRIST_WAYS 5
+
+extern u64 zobrist_table[MAX_GRIDS][2];
 
-extern u64 zobrist_table[N_GRIDS][2];
+/* What the score of an entry tells about the value of its position */
+enum zobrist_bound {
+    ZOBRIST_EXACT,
+    ZOBRIST_LOWER, /* the search failed high, the value is at least score */
+    ZOBRIST_UPPER, /* the search failed low, the value is at most score */
+};
 
+/* Search of depth plies, whose best move is move. The high bits of a key
+ * pick its bucket, and its low 32 bits tell it apart within the bucket.
+ * Entries stay valid for the whole game, the generation being that of the
+ * search, one per move, which stored them. An entry of depth 0 is empty.
+ */
 typedef struct {
-    u64 key;
-    int score;
-    int move;
-    struct hlist_node ht_list;
+    u32 check;
+    s32 score;
+    s16 move;
+    u8 depth : 6;
+    u8 bound : 2; /* enum zobrist_bound */
+    u8 generation;
 } zobrist_entry_t;
 
 void zobrist_init(void);
+void zobrist_exit(void);
+void zobrist_new_game(void);
+void zobrist_prepare(void);
+void zobrist_new_search(void);
+u64 zobrist_key(const char *table);
 zobrist_entry_t *zobrist_get(u64 key);
-void zobrist_put(u64 key, int score, int move);
-void zobrist_clear(void);
+bool zobrist_reused(const zobrist_entry_t *entry);
+void zobrist_put(u64 key,
+                 int score,
+                 int move,
+                 int depth,
+                 enum zobrist_bound bound);